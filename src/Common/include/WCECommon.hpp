@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../src/Constants.hpp"
+#include "../src/BandIntegral.hpp"
 #include "../src/CommonWavelengths.hpp"
 #include "../src/EnumerationTemplate.hpp"
 #include "../src/FenestrationCommon.hpp"
@@ -8,6 +9,8 @@
 #include "../src/IntegratorStrategy.hpp"
 #include "../src/Interpolation2D.hpp"
 #include "../src/LinearSolver.hpp"
+#include "../src/BandedMatrix.hpp"
+#include "../src/LUFactorization.hpp"
 #include "../src/MathFunctions.hpp"
 #include "../src/MatrixSeries.hpp"
 #include "../src/Series.hpp"
@@ -20,4 +23,5 @@
 #include "../src/WavelengthSpectrum.hpp"
 #include "../src/Table2D.hpp"
 #include "../src/Table2DInterpolators.hpp"
+#include "../src/ThreadPool.hpp"
 #include "../src/Utility.hpp"
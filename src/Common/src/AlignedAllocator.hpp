@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace FenestrationCommon
+{
+    //! \brief Allocator that returns memory aligned to given boundary.
+    //!
+    //! Used for contiguous numeric buffers so that the compiler can emit aligned vector loads
+    //! in the hot loops of matrix kernels.
+    template<typename T, std::size_t Alignment = 64u>
+    class AlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept
+        {}
+
+        T * allocate(std::size_t n)
+        {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T * p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+        {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept
+        {
+            return false;
+        }
+    };
+
+    using AlignedVector = std::vector<double, AlignedAllocator<double>>;
+
+}   // namespace FenestrationCommon
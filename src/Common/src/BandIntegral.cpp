@@ -0,0 +1,128 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+#include "BandIntegral.hpp"
+#include "IntegratorStrategy.hpp"
+#include "Series.hpp"
+
+namespace FenestrationCommon
+{
+    BandIntegral::BandIntegral(const std::vector<double> & t_Wavelengths,
+                               const IntegrationType t_Integration,
+                               const double normalizationCoefficient,
+                               const double minLambda,
+                               const double maxLambda) :
+        m_Coefficients(t_Wavelengths.size(), 0)
+    {
+        const CIntegratorFactory aFactory = CIntegratorFactory();
+        const auto aIntegrator = aFactory.getIntegrator(t_Integration);
+        const auto aCoefficients{aIntegrator->coefficients(t_Wavelengths, normalizationCoefficient)};
+
+        // Integrated value k contributes to the sum only if it is within the range. Its weights
+        // are then distributed back to the points it was created from.
+        for(size_t k = 0u; k < aCoefficients.size(); ++k)
+        {
+            if(isInSumRange(aCoefficients.x[k], minLambda, maxLambda))
+            {
+                m_Coefficients[k] += aCoefficients.weight[k];
+                if(k < aCoefficients.nextWeight.size())
+                {
+                    m_Coefficients[k + 1] += aCoefficients.nextWeight[k];
+                }
+            }
+        }
+    }
+
+    double BandIntegral::integrate(const std::vector<double> & t_Values) const
+    {
+        if(t_Values.size() != m_Coefficients.size())
+        {
+            throw std::runtime_error("Values must be defined at integration wavelengths.");
+        }
+
+        double result{0};
+        for(size_t i = 0u; i < m_Coefficients.size(); ++i)
+        {
+            result += m_Coefficients[i] * t_Values[i];
+        }
+
+        return result;
+    }
+
+    double BandIntegral::integrate(const std::vector<double> & t_Values,
+                                   const std::vector<double> & t_Weights) const
+    {
+        if(t_Values.size() != m_Coefficients.size() || t_Weights.size() != m_Coefficients.size())
+        {
+            throw std::runtime_error("Values must be defined at integration wavelengths.");
+        }
+
+        double result{0};
+        for(size_t i = 0u; i < m_Coefficients.size(); ++i)
+        {
+            result += m_Coefficients[i] * t_Values[i] * t_Weights[i];
+        }
+
+        return result;
+    }
+
+    std::vector<double> BandIntegral::weighted(const std::vector<double> & t_Weights) const
+    {
+        if(t_Weights.size() != m_Coefficients.size())
+        {
+            throw std::runtime_error("Weights must be defined at integration wavelengths.");
+        }
+
+        std::vector<double> result(m_Coefficients.size());
+        for(size_t i = 0u; i < m_Coefficients.size(); ++i)
+        {
+            result[i] = m_Coefficients[i] * t_Weights[i];
+        }
+
+        return result;
+    }
+
+    const std::vector<double> & BandIntegral::coefficients() const
+    {
+        return m_Coefficients;
+    }
+
+    size_t BandIntegral::size() const
+    {
+        return m_Coefficients.size();
+    }
+
+    double weightedBandIntegral(const CSeries & t_Values,
+                                const CSeries & t_Weights,
+                                const IntegrationType t_Integration,
+                                const double normalizationCoefficient,
+                                const double minLambda,
+                                const double maxLambda)
+    {
+        const double WAVELENGTHTOLERANCE = 1e-10;
+
+        // Same as multiplication of two series, only common part of the series is used
+        const size_t minSize = std::min(t_Values.size(), t_Weights.size());
+        auto wavelengths{t_Values.getXArray()};
+        auto values{t_Values.getYArray()};
+        const auto weightWavelengths{t_Weights.getXArray()};
+        auto weights{t_Weights.getYArray()};
+        for(size_t i = 0u; i < minSize; ++i)
+        {
+            if(std::abs(wavelengths[i] - weightWavelengths[i]) > WAVELENGTHTOLERANCE)
+            {
+                throw std::runtime_error(
+                  "Values and weights must be defined at the same wavelengths.");
+            }
+        }
+        wavelengths.resize(minSize);
+        values.resize(minSize);
+        weights.resize(minSize);
+
+        const BandIntegral aIntegral(
+          wavelengths, t_Integration, normalizationCoefficient, minLambda, maxLambda);
+
+        return aIntegral.integrate(values, weights);
+    }
+}   // namespace FenestrationCommon
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+namespace FenestrationCommon
+{
+    enum class IntegrationType;
+    class CSeries;
+
+    //! \brief Precalculated coefficients for integrating values over the wavelength range.
+    //!
+    //! Integral of values over [minLambda, maxLambda] is a dot product of the values with the
+    //! coefficients. Result is the same as integrating series first and then summing integrated
+    //! series over the range (see CSeries::sum), but no intermediate series is created.
+    //! Coefficients depend only on wavelengths, integration type and range so the same object can
+    //! be reused for any number of series defined at the same wavelengths.
+    class BandIntegral
+    {
+    public:
+        BandIntegral(const std::vector<double> & t_Wavelengths,
+                     IntegrationType t_Integration,
+                     double normalizationCoefficient,
+                     double minLambda,
+                     double maxLambda);
+
+        [[nodiscard]] double integrate(const std::vector<double> & t_Values) const;
+
+        //! Integral of values multiplied with weights (usually source spectrum)
+        [[nodiscard]] double integrate(const std::vector<double> & t_Values,
+                                       const std::vector<double> & t_Weights) const;
+
+        //! Coefficients multiplied with weights. Integral of any values with the same weights is
+        //! then simple dot product with the result.
+        [[nodiscard]] std::vector<double> weighted(const std::vector<double> & t_Weights) const;
+
+        [[nodiscard]] const std::vector<double> & coefficients() const;
+        [[nodiscard]] size_t size() const;
+
+    private:
+        std::vector<double> m_Coefficients;
+    };
+
+    //! Integral of series multiplied with weights over the wavelength range. Series and weights
+    //! must be defined at the same wavelengths. As with series multiplication, only the common
+    //! part of the two series is used.
+    [[nodiscard]] double weightedBandIntegral(const CSeries & t_Values,
+                                              const CSeries & t_Weights,
+                                              IntegrationType t_Integration,
+                                              double normalizationCoefficient,
+                                              double minLambda,
+                                              double maxLambda);
+}   // namespace FenestrationCommon
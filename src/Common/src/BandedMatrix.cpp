@@ -0,0 +1,154 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+#include "BandedMatrix.hpp"
+
+namespace FenestrationCommon
+{
+    BandedMatrix::BandedMatrix(const std::size_t tSize,
+                               const std::size_t tLowerBandwidth,
+                               const std::size_t tUpperBandwidth) :
+        m_Size(tSize),
+        m_Lower(tLowerBandwidth),
+        m_Upper(tUpperBandwidth),
+        m_Width(2 * tLowerBandwidth + tUpperBandwidth + 1),
+        m_Band(tSize * m_Width, 0.0),
+        m_Pivot(tSize, 0u)
+    {}
+
+    std::size_t BandedMatrix::size() const
+    {
+        return m_Size;
+    }
+
+    std::size_t BandedMatrix::lowerBandwidth() const
+    {
+        return m_Lower;
+    }
+
+    std::size_t BandedMatrix::upperBandwidth() const
+    {
+        return m_Upper;
+    }
+
+    void BandedMatrix::setZeros()
+    {
+        std::fill(m_Band.begin(), m_Band.end(), 0.0);
+        m_Factored = false;
+    }
+
+    std::size_t BandedMatrix::index(const std::size_t i, const std::size_t j) const
+    {
+        // Row i stores columns from i - lower to i + upper + lower
+        return i * m_Width + j + m_Lower - i;
+    }
+
+    double BandedMatrix::operator()(const std::size_t i, const std::size_t j) const
+    {
+        if(j + m_Lower < i || j > i + m_Upper + m_Lower)
+        {
+            return 0.0;
+        }
+        return m_Band[index(i, j)];
+    }
+
+    double & BandedMatrix::operator()(const std::size_t i, const std::size_t j)
+    {
+        if(i >= m_Size || j >= m_Size || j + m_Lower < i || j > i + m_Upper)
+        {
+            throw std::runtime_error("Element is outside of the matrix band.");
+        }
+        return m_Band[index(i, j)];
+    }
+
+    void BandedMatrix::factorize()
+    {
+        // Same safeguard for singular matrices as in LUFactorization
+        const auto TINY(1e-20);
+
+        double * a{m_Band.data()};
+        for(std::size_t k = 0u; k < m_Size; ++k)
+        {
+            const auto lastRow{std::min(m_Size - 1u, k + m_Lower)};
+            const auto lastColumn{std::min(m_Size - 1u, k + m_Upper + m_Lower)};
+
+            std::size_t pivotRow{k};
+            auto pivotValue{std::abs(a[index(k, k)])};
+            for(std::size_t i = k + 1u; i <= lastRow; ++i)
+            {
+                const auto value{std::abs(a[index(i, k)])};
+                if(value > pivotValue)
+                {
+                    pivotValue = value;
+                    pivotRow = i;
+                }
+            }
+            m_Pivot[k] = pivotRow;
+            if(pivotRow != k)
+            {
+                // Both rows are storing columns from k to the last column of the pivot row
+                std::swap_ranges(
+                  a + index(k, k), a + index(k, lastColumn) + 1u, a + index(pivotRow, k));
+            }
+
+            double * kRow{a + index(k, k)};
+            if(kRow[0] == 0.0)
+            {
+                kRow[0] = TINY;
+            }
+
+            const auto invPivot{1.0 / kRow[0]};
+            for(std::size_t i = k + 1u; i <= lastRow; ++i)
+            {
+                double * iRow{a + index(i, k)};
+                const auto factor{iRow[0] * invPivot};
+                iRow[0] = factor;
+                if(factor == 0.0)
+                {
+                    continue;
+                }
+                for(std::size_t j = 1u; j <= lastColumn - k; ++j)
+                {
+                    iRow[j] -= factor * kRow[j];
+                }
+            }
+        }
+        m_Factored = true;
+    }
+
+    void BandedMatrix::solve(std::vector<double> & b) const
+    {
+        if(b.size() != m_Size)
+        {
+            throw std::runtime_error(
+              "Matrix and vector for system of linear equations are not same size.");
+        }
+        if(!m_Factored)
+        {
+            throw std::runtime_error("Banded matrix must be factored before solving the system.");
+        }
+
+        const double * a{m_Band.data()};
+        for(std::size_t k = 0u; k < m_Size; ++k)
+        {
+            std::swap(b[k], b[m_Pivot[k]]);
+            const auto lastRow{std::min(m_Size - 1u, k + m_Lower)};
+            for(std::size_t i = k + 1u; i <= lastRow; ++i)
+            {
+                b[i] -= a[index(i, k)] * b[k];
+            }
+        }
+
+        for(std::size_t i = m_Size; i-- > 0u;)
+        {
+            const auto lastColumn{std::min(m_Size - 1u, i + m_Upper + m_Lower)};
+            auto sum{b[i]};
+            for(std::size_t j = i + 1u; j <= lastColumn; ++j)
+            {
+                sum -= a[index(i, j)] * b[j];
+            }
+            b[i] = sum / a[index(i, i)];
+        }
+    }
+}   // namespace FenestrationCommon
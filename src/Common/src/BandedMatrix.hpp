@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace FenestrationCommon
+{
+    //! \brief Square matrix with non-zero elements only within given number of diagonals below
+    //! (lower bandwidth) and above (upper bandwidth) the main diagonal.
+    //!
+    //! Every row keeps additional lower bandwidth elements above the band so the matrix can be
+    //! factored in place with partial pivoting. Memory is allocated only in the constructor, which
+    //! makes the matrix suitable for repeated assembling and solving inside iterations.
+    class BandedMatrix
+    {
+    public:
+        explicit BandedMatrix(std::size_t tSize = 0,
+                              std::size_t tLowerBandwidth = 0,
+                              std::size_t tUpperBandwidth = 0);
+
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] std::size_t lowerBandwidth() const;
+        [[nodiscard]] std::size_t upperBandwidth() const;
+
+        void setZeros();
+
+        //! Elements outside of the band are zero
+        double operator()(std::size_t i, std::size_t j) const;
+        //! Throws if element is outside of the band
+        double & operator()(std::size_t i, std::size_t j);
+
+        //! Factors matrix in place as P * A = L * U. Elements of the matrix are replaced with the
+        //! factors so the matrix has to be assembled again before next factorization.
+        void factorize();
+
+        //! Solves A * x = b in place. Matrix must be factored before the call.
+        void solve(std::vector<double> & b) const;
+
+    private:
+        [[nodiscard]] std::size_t index(std::size_t i, std::size_t j) const;
+
+        std::size_t m_Size;
+        std::size_t m_Lower;
+        std::size_t m_Upper;
+        // Number of stored elements per row
+        std::size_t m_Width;
+        std::vector<double> m_Band;
+        std::vector<std::size_t> m_Pivot;
+        bool m_Factored{false};
+    };
+}   // namespace FenestrationCommon
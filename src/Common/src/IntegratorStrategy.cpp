@@ -9,128 +9,166 @@ namespace FenestrationCommon
         return x2 - x1;
     }
 
-    CSeries
-      CIntegratorRectangular::integrate(const std::vector<CSeriesPoint> & t_Series,
-                                        double normalizationCoeff)
+    size_t IntegrationCoefficients::size() const
     {
-        CSeries newProperties;
-        for(auto i = 1u; i < t_Series.size(); ++i)
+        return weight.size();
+    }
+
+    std::vector<double> IntegrationCoefficients::apply(const std::vector<double> & t_Values) const
+    {
+        std::vector<double> result(weight.size());
+        for(size_t k = 0u; k < weight.size(); ++k)
         {
-            const auto w1 = t_Series[i - 1].x();
-            const auto w2 = t_Series[i].x();
-            const auto y1 = t_Series[i - 1].value();
+            result[k] = weight[k] * t_Values[k];
+        }
+        for(size_t k = 0u; k < nextWeight.size(); ++k)
+        {
+            result[k] += nextWeight[k] * t_Values[k + 1];
+        }
+
+        return result;
+    }
+
+    CSeries IIntegratorStrategy::integrate(const std::vector<double> & t_x,
+                                           const std::vector<double> & t_Values,
+                                           double normalizationCoeff) const
+    {
+        auto aCoefficients{coefficients(t_x, normalizationCoeff)};
+        auto values{aCoefficients.apply(t_Values)};
+        return {std::move(aCoefficients.x), std::move(values)};
+    }
+
+    CSeries IIntegratorStrategy::integrate(const std::vector<CSeriesPoint> & t_Series,
+                                           double normalizationCoeff) const
+    {
+        std::vector<double> x;
+        std::vector<double> values;
+        x.reserve(t_Series.size());
+        values.reserve(t_Series.size());
+        for(const auto & point : t_Series)
+        {
+            x.push_back(point.x());
+            values.push_back(point.value());
+        }
+        return integrate(x, values, normalizationCoeff);
+    }
+
+    IntegrationCoefficients
+      CIntegratorRectangular::coefficients(const std::vector<double> & t_x,
+                                           double normalizationCoeff) const
+    {
+        IntegrationCoefficients result;
+        for(auto i = 1u; i < t_x.size(); ++i)
+        {
+            const auto w1 = t_x[i - 1];
+            const auto w2 = t_x[i];
             const auto deltaX = dX(w1, w2);
-            const auto value = y1 * deltaX;
-            newProperties.addProperty(w1, value / normalizationCoeff);
+            result.x.push_back(w1);
+            result.weight.push_back(deltaX / normalizationCoeff);
         }
 
-        return newProperties;
+        return result;
     }
 
-    CSeries CIntegratorRectangularCentroid::integrate(const std::vector<CSeriesPoint> & t_Series, double normalizationCoeff)
+    IntegrationCoefficients
+      CIntegratorRectangularCentroid::coefficients(const std::vector<double> & t_x,
+                                                   double normalizationCoeff) const
     {
-        CSeries newProperties;
-        for(auto i = 1u; i < t_Series.size(); ++i)
+        IntegrationCoefficients result;
+        for(auto i = 1u; i < t_x.size(); ++i)
         {
-            const auto w1 = t_Series[i - 1].x();
-            const auto w2 = t_Series[i].x();
-            const auto y1 = t_Series[i - 1].value();
+            const auto w1 = t_x[i - 1];
+            const auto w2 = t_x[i];
             const auto diffX = (w2 - w1) / 2;
             const auto deltaX = dX(w1 - diffX, w2 - diffX);
-            const auto value = y1 * deltaX;
-            newProperties.addProperty(w1, value / normalizationCoeff);
+            result.x.push_back(w1);
+            result.weight.push_back(deltaX / normalizationCoeff);
         }
 
-        return newProperties;
+        return result;
     }
 
-    CSeries
-      CIntegratorTrapezoidal::integrate(const std::vector<CSeriesPoint> & t_Series,
-                                        double normalizationCoeff)
+    IntegrationCoefficients
+      CIntegratorTrapezoidal::coefficients(const std::vector<double> & t_x,
+                                           double normalizationCoeff) const
     {
-        CSeries newProperties;
-        for(auto i = 1u; i < t_Series.size(); ++i)
+        IntegrationCoefficients result;
+        for(auto i = 1u; i < t_x.size(); ++i)
         {
-            const auto w1 = t_Series[i - 1].x();
-            const auto w2 = t_Series[i].x();
-            const auto y1 = t_Series[i - 1].value();
-            const auto y2 = t_Series[i].value();
+            const auto w1 = t_x[i - 1];
+            const auto w2 = t_x[i];
             const auto deltaX = dX(w1, w2);
-            const auto yCenter = (y1 + y2) / 2;
-            const auto value = yCenter * deltaX;
-            newProperties.addProperty(w1, value / normalizationCoeff);
+            result.x.push_back(w1);
+            result.weight.push_back(deltaX / 2 / normalizationCoeff);
+            result.nextWeight.push_back(deltaX / 2 / normalizationCoeff);
         }
 
-        return newProperties;
+        return result;
     }
 
     /// TrapezoidalA integration insert additional items before and after first and
     /// last wavelenghts Since WCE is working strictly within wavelengths,
     /// contributions will be added to first and last segment
-    CSeries CIntegratorTrapezoidalA::integrate(const std::vector<CSeriesPoint> & t_Series, double normalizationCoeff)
+    IntegrationCoefficients
+      CIntegratorTrapezoidalA::coefficients(const std::vector<double> & t_x,
+                                            double normalizationCoeff) const
     {
-        CSeries newProperties;
-
-        for(auto i = 1u; i < t_Series.size(); ++i)
+        IntegrationCoefficients result;
+        for(auto i = 1u; i < t_x.size(); ++i)
         {
-            const auto w1 = t_Series[i - 1].x();
-            const auto w2 = t_Series[i].x();
-            const auto y1 = t_Series[i - 1].value();
-            const auto y2 = t_Series[i].value();
+            const auto w1 = t_x[i - 1];
+            const auto w2 = t_x[i];
             const auto deltaX = dX(w1, w2);
-            const auto yCenter = (y1 + y2) / 2;
-            auto value = yCenter * deltaX;
+            auto weight = deltaX / 2;
+            auto nextWeight = deltaX / 2;
             if(i == 1)
             {
-                value += (y1 / 2) * deltaX;
+                weight += deltaX / 2;
             }
-            if(i == t_Series.size() - 1)
+            if(i == t_x.size() - 1)
             {
-                value += (y2 / 2) * deltaX;
+                nextWeight += deltaX / 2;
             }
-            newProperties.addProperty(w1, value / normalizationCoeff);
+            result.x.push_back(w1);
+            result.weight.push_back(weight / normalizationCoeff);
+            result.nextWeight.push_back(nextWeight / normalizationCoeff);
         }
 
-        return newProperties;
+        return result;
     }
 
-    CSeries CIntegratorTrapezoidalB::integrate(const std::vector<CSeriesPoint> & t_Series, double normalizationCoeff)
+    IntegrationCoefficients
+      CIntegratorTrapezoidalB::coefficients(const std::vector<double> & t_x,
+                                            double normalizationCoeff) const
     {
-        CSeries newProperties;
-
-        for(auto i = 1u; i < t_Series.size(); ++i)
+        IntegrationCoefficients result;
+        for(auto i = 1u; i < t_x.size(); ++i)
         {
-            const auto w1 = t_Series[i - 1].x();
-            const auto w2 = t_Series[i].x();
-            const auto y1 = t_Series[i - 1].value();
-            const auto y2 = t_Series[i].value();
+            const auto w1 = t_x[i - 1];
+            const auto w2 = t_x[i];
             const auto deltaX = dX(w1, w2);
-            const auto yCenter = (y1 + y2) / 2;
-            auto value = yCenter * deltaX;
-            if(i == 1 || i == t_Series.size() - 1)
+            auto weight = deltaX / 2;
+            if(i == 1 || i == t_x.size() - 1)
             {
-                value += ((y1 + y2) / 4) * deltaX;
+                weight += deltaX / 4;
             }
-            newProperties.addProperty(w1, value / normalizationCoeff);
+            result.x.push_back(w1);
+            result.weight.push_back(weight / normalizationCoeff);
+            result.nextWeight.push_back(weight / normalizationCoeff);
         }
 
-        return newProperties;
+        return result;
     }
 
-    CSeries
-      CIntegratorPreWeighted::integrate(const std::vector<CSeriesPoint> & t_Series,
-                                        double normalizationCoeff)
+    IntegrationCoefficients
+      CIntegratorPreWeighted::coefficients(const std::vector<double> & t_x,
+                                           double normalizationCoeff) const
     {
-        CSeries newProperties;
-
-        for(auto i = 0u; i < t_Series.size(); ++i)
-        {
-            const auto y1 = t_Series[i].value();
-
-            newProperties.addProperty(1, y1 / normalizationCoeff);
-        }
+        IntegrationCoefficients result;
+        result.x = std::vector<double>(t_x.size(), 1);
+        result.weight = std::vector<double>(t_x.size(), 1 / normalizationCoeff);
 
-        return newProperties;
+        return result;
     }
 
     std::unique_ptr<IIntegratorStrategy>
@@ -22,13 +22,37 @@ namespace FenestrationCommon
 
     class CSeries;
 
+    //! \brief Integration over given x values expressed as linear combination of the values.
+    //!
+    //! Integrated value at index k is equal to weight[k] * y[k] + nextWeight[k] * y[k + 1].
+    //! Integrations that use only one point per range leave nextWeight empty. Coefficients depend
+    //! only on the x values so they can be calculated once and applied to any number of series
+    //! that share the same wavelengths.
+    struct IntegrationCoefficients
+    {
+        std::vector<double> x;
+        std::vector<double> weight;
+        std::vector<double> nextWeight;
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] std::vector<double> apply(const std::vector<double> & t_Values) const;
+    };
+
     class IIntegratorStrategy
     {
     public:
         virtual ~IIntegratorStrategy() = default;
-        
-        virtual CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                                  double normalizationCoeff = 1) = 0;
+
+        [[nodiscard]] virtual IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const = 0;
+
+        //! Integrates series given with separate x and value arrays
+        CSeries integrate(const std::vector<double> & t_x,
+                          const std::vector<double> & t_Values,
+                          double normalizationCoeff) const;
+
+        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
+                          double normalizationCoeff = 1) const;
 
     protected:
         double dX(double x1, double x2) const;
@@ -37,43 +61,43 @@ namespace FenestrationCommon
     class CIntegratorRectangular : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorRectangularCentroid : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorTrapezoidal : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorTrapezoidalA : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorTrapezoidalB : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorPreWeighted : public IIntegratorStrategy
     {
     public:
-        CSeries integrate(const std::vector<CSeriesPoint> & t_Series,
-                          double normalizationCoeff) override;
+        [[nodiscard]] IntegrationCoefficients
+          coefficients(const std::vector<double> & t_x, double normalizationCoeff) const override;
     };
 
     class CIntegratorFactory
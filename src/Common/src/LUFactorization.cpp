@@ -0,0 +1,268 @@
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+#include "LUFactorization.hpp"
+
+namespace FenestrationCommon
+{
+    LUFactorization::LUFactorization(SquareMatrix tMatrix) :
+        m_LU(std::move(tMatrix)),
+        m_Pivot(m_LU.size())
+    {
+        // Same safeguard for singular matrices as in SquareMatrix::makeUpperTriangular
+        const auto TINY(1e-20);
+
+        const auto n{m_LU.size()};
+        double * a{m_LU.data()};
+
+        for(std::size_t k = 0u; k < n; ++k)
+        {
+            std::size_t pivotRow{k};
+            auto pivotValue{std::abs(a[k * n + k])};
+            for(std::size_t i = k + 1u; i < n; ++i)
+            {
+                const auto value{std::abs(a[i * n + k])};
+                if(value > pivotValue)
+                {
+                    pivotValue = value;
+                    pivotRow = i;
+                }
+            }
+            m_Pivot[k] = pivotRow;
+            if(pivotRow != k)
+            {
+                std::swap_ranges(a + k * n, a + (k + 1u) * n, a + pivotRow * n);
+            }
+
+            double * kRow{a + k * n};
+            if(kRow[k] == 0.0)
+            {
+                kRow[k] = TINY;
+            }
+
+            const auto invPivot{1.0 / kRow[k]};
+            for(std::size_t i = k + 1u; i < n; ++i)
+            {
+                double * iRow{a + i * n};
+                const auto factor{iRow[k] * invPivot};
+                iRow[k] = factor;
+                if(factor == 0.0)
+                {
+                    continue;
+                }
+                for(std::size_t j = k + 1u; j < n; ++j)
+                {
+                    iRow[j] -= factor * kRow[j];
+                }
+            }
+        }
+    }
+
+    std::size_t LUFactorization::size() const
+    {
+        return m_LU.size();
+    }
+
+    std::vector<double> LUFactorization::solve(const std::vector<double> & b) const
+    {
+        const auto n{m_LU.size()};
+        if(b.size() != n)
+        {
+            throw std::runtime_error(
+              "Matrix and vector for system of linear equations are not same size.");
+        }
+
+        std::vector<double> x(b);
+        for(std::size_t k = 0u; k < n; ++k)
+        {
+            std::swap(x[k], x[m_Pivot[k]]);
+        }
+
+        const double * a{m_LU.data()};
+        for(std::size_t i = 0u; i < n; ++i)
+        {
+            const double * iRow{a + i * n};
+            auto sum{x[i]};
+            for(std::size_t j = 0u; j < i; ++j)
+            {
+                sum -= iRow[j] * x[j];
+            }
+            x[i] = sum;
+        }
+
+        for(std::size_t ii = n; ii > 0u; --ii)
+        {
+            const auto i{ii - 1u};
+            const double * iRow{a + i * n};
+            auto sum{x[i]};
+            for(std::size_t j = i + 1u; j < n; ++j)
+            {
+                sum -= iRow[j] * x[j];
+            }
+            x[i] = sum / iRow[i];
+        }
+
+        return x;
+    }
+
+    SquareMatrix LUFactorization::solve(const SquareMatrix & B) const
+    {
+        const auto n{m_LU.size()};
+        if(B.size() != n)
+        {
+            throw std::runtime_error("Matrices must be identical in size.");
+        }
+
+        SquareMatrix X(B);
+        double * x{X.data()};
+        for(std::size_t k = 0u; k < n; ++k)
+        {
+            if(m_Pivot[k] != k)
+            {
+                std::swap_ranges(x + k * n, x + (k + 1u) * n, x + m_Pivot[k] * n);
+            }
+        }
+
+        // Substitutions are done on full rows of the right hand side so that inner loops run over
+        // contiguous memory for all right hand sides at once.
+        const double * a{m_LU.data()};
+        for(std::size_t i = 0u; i < n; ++i)
+        {
+            double * xRow{x + i * n};
+            for(std::size_t j = 0u; j < i; ++j)
+            {
+                const auto lij{a[i * n + j]};
+                if(lij == 0.0)
+                {
+                    continue;
+                }
+                const double * yRow{x + j * n};
+                for(std::size_t m = 0u; m < n; ++m)
+                {
+                    xRow[m] -= lij * yRow[m];
+                }
+            }
+        }
+
+        for(std::size_t ii = n; ii > 0u; --ii)
+        {
+            const auto i{ii - 1u};
+            double * xRow{x + i * n};
+            for(std::size_t j = i + 1u; j < n; ++j)
+            {
+                const auto uij{a[i * n + j]};
+                if(uij == 0.0)
+                {
+                    continue;
+                }
+                const double * yRow{x + j * n};
+                for(std::size_t m = 0u; m < n; ++m)
+                {
+                    xRow[m] -= uij * yRow[m];
+                }
+            }
+            const auto invDiag{1.0 / a[i * n + i]};
+            for(std::size_t m = 0u; m < n; ++m)
+            {
+                xRow[m] *= invDiag;
+            }
+        }
+
+        return X;
+    }
+
+    std::vector<std::vector<double>>
+      LUFactorization::solve(const std::vector<std::vector<double>> & b) const
+    {
+        const auto n{m_LU.size()};
+        const auto m{b.size()};
+
+        // Right hand sides are stored as columns of row-major buffer so that substitutions run
+        // over contiguous memory for all of them at once
+        std::vector<double> x(n * m);
+        for(std::size_t k = 0u; k < m; ++k)
+        {
+            if(b[k].size() != n)
+            {
+                throw std::runtime_error(
+                  "Matrix and vector for system of linear equations are not same size.");
+            }
+            for(std::size_t i = 0u; i < n; ++i)
+            {
+                x[i * m + k] = b[k][i];
+            }
+        }
+
+        for(std::size_t k = 0u; k < n; ++k)
+        {
+            if(m_Pivot[k] != k)
+            {
+                std::swap_ranges(
+                  x.begin() + k * m, x.begin() + (k + 1u) * m, x.begin() + m_Pivot[k] * m);
+            }
+        }
+
+        const double * a{m_LU.data()};
+        for(std::size_t i = 0u; i < n; ++i)
+        {
+            double * xRow{x.data() + i * m};
+            for(std::size_t j = 0u; j < i; ++j)
+            {
+                const auto lij{a[i * n + j]};
+                if(lij == 0.0)
+                {
+                    continue;
+                }
+                const double * yRow{x.data() + j * m};
+                for(std::size_t k = 0u; k < m; ++k)
+                {
+                    xRow[k] -= lij * yRow[k];
+                }
+            }
+        }
+
+        for(std::size_t ii = n; ii > 0u; --ii)
+        {
+            const auto i{ii - 1u};
+            double * xRow{x.data() + i * m};
+            for(std::size_t j = i + 1u; j < n; ++j)
+            {
+                const auto uij{a[i * n + j]};
+                if(uij == 0.0)
+                {
+                    continue;
+                }
+                const double * yRow{x.data() + j * m};
+                for(std::size_t k = 0u; k < m; ++k)
+                {
+                    xRow[k] -= uij * yRow[k];
+                }
+            }
+            const auto invDiag{1.0 / a[i * n + i]};
+            for(std::size_t k = 0u; k < m; ++k)
+            {
+                xRow[k] *= invDiag;
+            }
+        }
+
+        std::vector<std::vector<double>> result(m, std::vector<double>(n));
+        for(std::size_t k = 0u; k < m; ++k)
+        {
+            for(std::size_t i = 0u; i < n; ++i)
+            {
+                result[k][i] = x[i * m + k];
+            }
+        }
+
+        return result;
+    }
+
+    SquareMatrix LUFactorization::inverse() const
+    {
+        SquareMatrix identity(m_LU.size());
+        identity.setIdentity();
+        return solve(identity);
+    }
+
+}   // namespace FenestrationCommon
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+#include "SquareMatrix.hpp"
+
+namespace FenestrationCommon
+{
+    //! \brief LU factorization with partial (row) pivoting of the square matrix.
+    //!
+    //! Matrix is factored once in the constructor as P * A = L * U and can then be used to solve
+    //! any number of right hand sides. Solving against the factor is cheaper and numerically more
+    //! stable than forming an explicit inverse and multiplying with it.
+    class LUFactorization
+    {
+    public:
+        explicit LUFactorization(SquareMatrix tMatrix);
+
+        [[nodiscard]] std::size_t size() const;
+
+        //! Solves A * x = b
+        [[nodiscard]] std::vector<double> solve(const std::vector<double> & b) const;
+
+        //! Solves A * X = B for all columns of B at once
+        [[nodiscard]] SquareMatrix solve(const SquareMatrix & B) const;
+
+        //! Solves A * x = b for every right hand side in the list with single substitution sweep
+        [[nodiscard]] std::vector<std::vector<double>>
+          solve(const std::vector<std::vector<double>> & b) const;
+
+        [[nodiscard]] SquareMatrix inverse() const;
+
+    private:
+        SquareMatrix m_LU;
+        std::vector<std::size_t> m_Pivot;
+    };
+
+}   // namespace FenestrationCommon
@@ -1,51 +1,103 @@
 #include <cassert>
 #include <stdexcept>
-
-#include <thread>
+#include <algorithm>
+#include <cmath>
 
 #include "MatrixSeries.hpp"
 #include "SquareMatrix.hpp"
 #include "Series.hpp"
 #include "IntegratorStrategy.hpp"
-#include "Utility.hpp"
+#include "ThreadPool.hpp"
 
 
 namespace FenestrationCommon
 {
-    CMatrixSeries::CMatrixSeries(const size_t t_Size1, const size_t t_Size2, size_t seriesSize) :
-        m_Size1(t_Size1),
-        m_Size2(t_Size2)
+    namespace
     {
-        m_Matrix = std::vector<std::vector<CSeries>>(m_Size1);
-        for(size_t i = 0; i < m_Size1; ++i)
+        const double WAVELENGTHTOLERANCE = 1e-10;
+
+        void checkWavelengths(const std::vector<double> & t_Wavelengths,
+                              const CSeries & t_Series,
+                              const size_t size)
         {
-            m_Matrix[i].resize(m_Size2);
-            for(size_t j = 0; j < m_Size2; ++j)
+            const auto x{t_Series.getXArray()};
+            for(size_t k = 0u; k < size; ++k)
             {
-                m_Matrix[i][j] = CSeries(seriesSize);
+                if(std::abs(t_Wavelengths[k] - x[k]) > WAVELENGTHTOLERANCE)
+                {
+                    throw std::runtime_error("The wavelengths of the two vectors are not the same. "
+                                             "Cannot perform multiplication.");
+                }
             }
         }
-    }
+        std::vector<std::vector<double>> scaledSums(const size_t t_Size1,
+                                                    const size_t t_Size2,
+                                                    const std::vector<double> & t_Sums,
+                                                    const std::vector<double> & t_ScaleValue)
+        {
+            if(t_Size2 != t_ScaleValue.size())
+            {
+                throw std::runtime_error(
+                  "Size of vector for scaling must be same as size of the matrix.");
+            }
+
+            std::vector<std::vector<double>> Result(t_Size1, std::vector<double>(t_Size2));
+            for(size_t i = 0; i < t_Size1; ++i)
+            {
+                for(size_t j = 0; j < t_Size2; ++j)
+                {
+                    Result[i][j] = t_Sums[i * t_Size2 + j] / t_ScaleValue[i];
+                }
+            }
+            return Result;
+        }
+
+        SquareMatrix scaledSquaredMatrix(const size_t t_Size1,
+                                         const size_t t_Size2,
+                                         const std::vector<double> & t_Sums,
+                                         const std::vector<double> & t_ScaleValue)
+        {
+            assert(t_Size1 == t_Size2);
+
+            SquareMatrix Res(t_Size1);
+            for(size_t i = 0; i < t_Size1; ++i)
+            {
+                for(size_t j = 0; j < t_Size2; ++j)
+                {
+                    Res(i, j) = t_Sums[i * t_Size2 + j] / t_ScaleValue[i];
+                }
+            }
+            return Res;
+        }
+    }   // namespace
+
+    CMatrixSeries::CMatrixSeries(const size_t t_Size1, const size_t t_Size2, size_t seriesSize) :
+        m_Size1(t_Size1),
+        m_Size2(t_Size2),
+        m_Wavelengths(seriesSize, 0),
+        m_Values(seriesSize * t_Size1 * t_Size2, 0)
+    {}
 
-    CMatrixSeries::CMatrixSeries(const CMatrixSeries & t_MatrixSeries)
+    size_t CMatrixSeries::blockSize() const
     {
-        *this = t_MatrixSeries;
+        return m_Size1 * m_Size2;
     }
 
-    CMatrixSeries & CMatrixSeries::operator=(CMatrixSeries const & t_MatrixSeries)
+    size_t CMatrixSeries::wavelengthIndex(const double t_Wavelength)
     {
-        m_Size1 = t_MatrixSeries.m_Size1;
-        m_Size2 = t_MatrixSeries.m_Size2;
-        m_Matrix = std::vector<std::vector<CSeries>>(m_Size1);
-        for(size_t i = 0; i < m_Size1; ++i)
+        // Properties are usually added in ascending order so search starts from the back
+        for(size_t k = m_Wavelengths.size(); k > 0u; --k)
         {
-            m_Matrix[i].resize(m_Size2);
-            for(size_t j = 0; j < m_Size2; ++j)
+            if(std::abs(m_Wavelengths[k - 1] - t_Wavelength) < WAVELENGTHTOLERANCE)
             {
-                m_Matrix[i][j] = CSeries(t_MatrixSeries.m_Matrix[i][j]);
+                return k - 1;
             }
         }
-        return *this;
+
+        m_Wavelengths.push_back(t_Wavelength);
+        m_Values.resize(m_Values.size() + blockSize(), 0);
+
+        return m_Wavelengths.size() - 1;
     }
 
     void CMatrixSeries::addProperty(const size_t i,
@@ -53,17 +105,16 @@ namespace FenestrationCommon
                                     const double t_Wavelength,
                                     const double t_Value)
     {
-        m_Matrix[i][j].addProperty(t_Wavelength, t_Value);
+        const auto k{wavelengthIndex(t_Wavelength)};
+        m_Values[k * blockSize() + i * m_Size2 + j] = t_Value;
     }
 
     void CMatrixSeries::addProperties(const size_t i,
                                       const double t_Wavelength,
                                       const std::vector<double> & t_Values)
     {
-        for(size_t j = 0; j < t_Values.size(); ++j)
-        {
-            m_Matrix[i][j].addProperty(t_Wavelength, t_Values[j]);
-        }
+        const auto k{wavelengthIndex(t_Wavelength)};
+        setPropertiesAtIndex(k, i, t_Wavelength, t_Values);
     }
 
     void CMatrixSeries::setPropertiesAtIndex(size_t index,
@@ -71,124 +122,251 @@ namespace FenestrationCommon
                                              double t_Wavelength,
                                              const std::vector<double> & t_Values)
     {
-        for(size_t j = 0; j < t_Values.size(); ++j)
-        {
-            m_Matrix[i][j].setPropertyAtIndex(index, t_Wavelength, t_Values[j]);
-        }
+        assert(t_Values.size() <= m_Size2);
+        m_Wavelengths[index] = t_Wavelength;
+        std::copy(t_Values.begin(),
+                  t_Values.end(),
+                  m_Values.begin() + index * blockSize() + i * m_Size2);
     }
 
     void CMatrixSeries::addProperties(const double t_Wavelength, const SquareMatrix & t_Matrix)
     {
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
-        {
-            assert(m_Matrix.size() == t_Matrix.size());
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
-            {
-                m_Matrix[i][j].addProperty(t_Wavelength, t_Matrix(i, j));
-            }
-        }
+        const auto k{wavelengthIndex(t_Wavelength)};
+        setPropertiesAtIndex(k, t_Wavelength, t_Matrix);
     }
 
     void CMatrixSeries::setPropertiesAtIndex(size_t index,
                                              double t_Wavelength,
                                              const SquareMatrix & t_Matrix)
     {
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
-        {
-            assert(m_Matrix.size() == t_Matrix.size());
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
-            {
-                m_Matrix[i][j].setPropertyAtIndex(index, t_Wavelength, t_Matrix(i, j));
-            }
-        }
+        assert(m_Size1 == t_Matrix.size() && m_Size2 == t_Matrix.size());
+        m_Wavelengths[index] = t_Wavelength;
+        std::copy(t_Matrix.data(),
+                  t_Matrix.data() + blockSize(),
+                  m_Values.begin() + index * blockSize());
     }
 
     void CMatrixSeries::addSeries(const size_t i, const size_t j, const CSeries & series)
     {
-        m_Matrix[i][j] = series;
+        if(m_Wavelengths.empty())
+        {
+            m_Wavelengths = series.getXArray();
+            m_Values.assign(m_Wavelengths.size() * blockSize(), 0);
+        }
+
+        if(series.size() != m_Wavelengths.size())
+        {
+            throw std::runtime_error(
+              "Series must have same wavelengths as the other series in the matrix.");
+        }
+
+        for(size_t k = 0u; k < m_Wavelengths.size(); ++k)
+        {
+            const auto point{series[k]};
+            if(std::abs(point.x() - m_Wavelengths[k]) > WAVELENGTHTOLERANCE)
+            {
+                throw std::runtime_error(
+                  "Series must have same wavelengths as the other series in the matrix.");
+            }
+            m_Values[k * blockSize() + i * m_Size2 + j] = point.value();
+        }
     }
 
     void CMatrixSeries::mMult(const CSeries & t_Series)
     {
-        // Parallelization here did not show any improvements. Program was performing even slower.
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
+        const auto size{std::min(m_Wavelengths.size(), t_Series.size())};
+        checkWavelengths(m_Wavelengths, t_Series, size);
+
+        m_Wavelengths.resize(size);
+        m_Values.resize(size * blockSize());
+
+        const auto multipliers{t_Series.getYArray()};
+
+        // Parallelization here did not show any improvements. Operation is bound by memory speed.
+        const auto block{blockSize()};
+        for(size_t k = 0u; k < size; ++k)
         {
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
+            const auto multiplier{multipliers[k]};
+            double * values{m_Values.data() + k * block};
+            for(size_t n = 0u; n < block; ++n)
             {
-                assert(t_Series.size() == m_Matrix[i][j].size());
-                m_Matrix[i][j] = m_Matrix[i][j] * t_Series;
+                values[n] *= multiplier;
             }
         }
     }
 
     void CMatrixSeries::mMult(const std::vector<CSeries> & t_Series)
     {
-        // Parallelization here did not show any improvements. Program was performing even slower.
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
+        if(t_Series.size() < m_Size1)
         {
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
+            throw std::runtime_error("Number of series must be same as number of matrix rows.");
+        }
+
+        auto size{m_Wavelengths.size()};
+        for(size_t i = 0u; i < m_Size1; ++i)
+        {
+            size = std::min(size, t_Series[i].size());
+        }
+
+        std::vector<std::vector<double>> multipliers(m_Size1);
+        for(size_t i = 0u; i < m_Size1; ++i)
+        {
+            checkWavelengths(m_Wavelengths, t_Series[i], size);
+            multipliers[i] = t_Series[i].getYArray();
+        }
+
+        m_Wavelengths.resize(size);
+        m_Values.resize(size * blockSize());
+
+        // Parallelization here did not show any improvements. Operation is bound by memory speed.
+        for(size_t k = 0u; k < size; ++k)
+        {
+            for(size_t i = 0u; i < m_Size1; ++i)
             {
-                m_Matrix[i][j] = m_Matrix[i][j] * t_Series[i];
+                const auto multiplier{multipliers[i][k]};
+                double * values{m_Values.data() + k * blockSize() + i * m_Size2};
+                for(size_t j = 0u; j < m_Size2; ++j)
+                {
+                    values[j] *= multiplier;
+                }
             }
         }
     }
 
-    std::vector<CSeries> & CMatrixSeries::operator[](const size_t index)
+    std::vector<CSeries> CMatrixSeries::operator[](const size_t index) const
     {
-        return m_Matrix[index];
+        std::vector<CSeries> result;
+        result.reserve(m_Size2);
+        for(size_t j = 0u; j < m_Size2; ++j)
+        {
+            std::vector<double> values(m_Wavelengths.size());
+            for(size_t k = 0u; k < m_Wavelengths.size(); ++k)
+            {
+                values[k] = m_Values[k * blockSize() + index * m_Size2 + j];
+            }
+            result.emplace_back(m_Wavelengths, std::move(values));
+        }
+        return result;
     }
 
     void CMatrixSeries::integrate(const IntegrationType t_Integration,
                                   double normalizationCoefficient,
                                   const std::optional<std::vector<double>> & integrationPoints)
     {
-        const auto numberOfThreads{FenestrationCommon::getNumberOfThreads(m_Matrix.size())};
-        const auto chunks{FenestrationCommon::chunkIt(0u, m_Matrix.size() - 1u, numberOfThreads)};
-
-        std::vector<std::thread> workers;
-        for(const auto & chunk : chunks)
+        if(integrationPoints.has_value())
         {
-            workers.emplace_back([&]() {
-                for(size_t i = chunk.start; i < chunk.end; ++i)
+            interpolate(integrationPoints.value());
+        }
+
+        const CIntegratorFactory aFactory = CIntegratorFactory();
+        const auto aIntegrator = aFactory.getIntegrator(t_Integration);
+        const auto coefficients{aIntegrator->coefficients(m_Wavelengths, normalizationCoefficient)};
+
+        const auto block{blockSize()};
+        std::vector<double> result(coefficients.size() * block);
+
+        parallel_for(0u, coefficients.size(), [&](const size_t start, const size_t end) {
+            for(size_t k = start; k < end; ++k)
+            {
+                const auto weight{coefficients.weight[k]};
+                const double * current{m_Values.data() + k * block};
+                double * res{result.data() + k * block};
+                for(size_t n = 0u; n < block; ++n)
+                {
+                    res[n] = weight * current[n];
+                }
+                if(k < coefficients.nextWeight.size())
                 {
-                    for(size_t j = 0u; j < m_Matrix[i].size(); ++j)
+                    const auto nextWeight{coefficients.nextWeight[k]};
+                    const double * next{current + block};
+                    for(size_t n = 0u; n < block; ++n)
                     {
-                        m_Matrix[i][j] = m_Matrix[i][j].integrate(
-                          t_Integration, normalizationCoefficient, integrationPoints);
+                        res[n] += nextWeight * next[n];
                     }
                 }
-            });
-        }
+            }
+        });
 
-        for(auto & worker : workers)
-        {
-            worker.join();
-        }
+        m_Wavelengths = coefficients.x;
+        m_Values = std::move(result);
     }
 
     void CMatrixSeries::interpolate(const std::vector<double> & t_Wavelengths)
     {
-        const auto numberOfThreads{FenestrationCommon::getNumberOfThreads(m_Matrix.size())};
-        const auto chunks{FenestrationCommon::chunkIt(0u, m_Matrix.size() - 1u, numberOfThreads)};
+        if(m_Wavelengths.empty() || t_Wavelengths == m_Wavelengths)
+        {
+            return;
+        }
 
-        std::vector<std::thread> workers;
-        for(const auto & chunk : chunks)
+        // Wavelengths are common for all the series so lower and upper points are found only once.
+        // Search is identical to the one in CSeries::interpolate and values outside of the range
+        // are extrapolated as constant.
+        const auto sorted{std::is_sorted(m_Wavelengths.begin(), m_Wavelengths.end())};
+        const auto size{m_Wavelengths.size()};
+        std::vector<size_t> lower(t_Wavelengths.size());
+        std::vector<size_t> upper(t_Wavelengths.size());
+        for(size_t n = 0u; n < t_Wavelengths.size(); ++n)
         {
-            workers.emplace_back([&]() {
-                for(size_t i = chunk.start; i < chunk.end; ++i)
+            const auto wavelength{t_Wavelengths[n]};
+            const auto it{
+              sorted ? std::upper_bound(m_Wavelengths.begin(), m_Wavelengths.end(), wavelength)
+                     : std::find_if(m_Wavelengths.begin(),
+                                    m_Wavelengths.end(),
+                                    [&](const double x) { return x > wavelength; })};
+            const auto index{static_cast<size_t>(it - m_Wavelengths.begin())};
+            upper[n] = index < size ? index : index - 1u;
+            lower[n] = index > 0u ? index - 1u : index;
+        }
+
+        const auto block{blockSize()};
+        std::vector<double> result(t_Wavelengths.size() * block);
+
+        parallel_for(0u, t_Wavelengths.size(), [&](const size_t start, const size_t end) {
+            for(size_t n = start; n < end; ++n)
+            {
+                const double * v1{m_Values.data() + lower[n] * block};
+                const double * v2{m_Values.data() + upper[n] * block};
+                double * res{result.data() + n * block};
+                const auto w1{m_Wavelengths[lower[n]]};
+                const auto w2{m_Wavelengths[upper[n]]};
+                if(w2 != w1)
                 {
-                    for(size_t j = 0u; j < m_Matrix[i].size(); ++j)
+                    const auto ratio{(t_Wavelengths[n] - w1) / (w2 - w1)};
+                    for(size_t m = 0u; m < block; ++m)
                     {
-                        m_Matrix[i][j] = m_Matrix[i][j].interpolate(t_Wavelengths);
+                        res[m] = v1[m] + ratio * (v2[m] - v1[m]);
                     }
                 }
-            });
-        }
+                else
+                {
+                    std::copy(v1, v1 + block, res);
+                }
+            }
+        });
 
-        for(auto & worker : workers)
+        m_Wavelengths = t_Wavelengths;
+        m_Values = std::move(result);
+    }
+
+    std::vector<double> CMatrixSeries::sumsOverRange(const double minLambda,
+                                                     const double maxLambda) const
+    {
+        const auto block{blockSize()};
+
+        std::vector<double> result(block, 0);
+        for(size_t k = 0u; k < m_Wavelengths.size(); ++k)
         {
-            worker.join();
+            if(isInSumRange(m_Wavelengths[k], minLambda, maxLambda))
+            {
+                const double * values{m_Values.data() + k * block};
+                for(size_t n = 0u; n < block; ++n)
+                {
+                    result[n] += values[n];
+                }
+            }
         }
+
+        return result;
     }
 
     std::vector<std::vector<double>>
@@ -196,46 +374,43 @@ namespace FenestrationCommon
                              const double maxLambda,
                              const std::vector<double> & t_ScaleValue) const
     {
-        std::vector<std::vector<double>> Result(m_Matrix.size());
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
-        {
-            if(m_Matrix[i].size() != t_ScaleValue.size())
-            {
-                throw std::runtime_error(
-                  "Size of vector for scaling must be same as size of the matrix.");
-            }
-            // Result[i] = std::make_shared<std::vector<double>>();
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
-            {
-                double value = m_Matrix[i][j].sum(minLambda, maxLambda) / t_ScaleValue[i];
-                Result[i].push_back(value);
-            }
-        }
-        return Result;
+        return scaledSums(m_Size1, m_Size2, sumsOverRange(minLambda, maxLambda), t_ScaleValue);
     }
 
     std::vector<std::vector<double>> CMatrixSeries::getSums(const double minLambda,
                                                             const double maxLambda) const
     {
-        const std::vector<double> scaleValue(m_Matrix[0].size(), 1);
+        const std::vector<double> scaleValue(m_Size2, 1);
         return getSums(minLambda, maxLambda, scaleValue);
     }
 
     SquareMatrix CMatrixSeries::getSquaredMatrixSums(const double minLambda,
                                                      const double maxLambda,
-                                                     const std::vector<double> & t_ScaleValue)
+                                                     const std::vector<double> & t_ScaleValue) const
     {
-        assert(m_Matrix.size() == m_Matrix[0].size());
-        SquareMatrix Res(m_Matrix.size());
-        for(size_t i = 0; i < m_Matrix.size(); ++i)
+        return scaledSquaredMatrix(
+          m_Size1, m_Size2, sumsOverRange(minLambda, maxLambda), t_ScaleValue);
+    }
+
+    CMatrixSeriesPrefixSums CMatrixSeries::prefixSums() const
+    {
+        const auto block{blockSize()};
+        std::vector<double> sums((m_Wavelengths.size() + 1u) * block, 0);
+
+        // Values are accumulated in the same order as in sumsOverRange so that the sum over the
+        // whole range is identical to it.
+        for(size_t k = 0u; k < m_Wavelengths.size(); ++k)
         {
-            for(size_t j = 0; j < m_Matrix[i].size(); ++j)
+            const double * values{m_Values.data() + k * block};
+            const double * previous{sums.data() + k * block};
+            double * current{sums.data() + (k + 1u) * block};
+            for(size_t n = 0u; n < block; ++n)
             {
-                double value = m_Matrix[i][j].sum(minLambda, maxLambda) / t_ScaleValue[i];
-                Res(i, j) = value;
+                current[n] = previous[n] + values[n];
             }
         }
-        return Res;
+
+        return {m_Size1, m_Size2, m_Wavelengths, std::move(sums)};
     }
 
     size_t CMatrixSeries::size1() const
@@ -248,4 +423,79 @@ namespace FenestrationCommon
         return m_Size2;
     }
 
+    const std::vector<double> & CMatrixSeries::getWavelengths() const
+    {
+        return m_Wavelengths;
+    }
+
+    CMatrixSeriesPrefixSums::CMatrixSeriesPrefixSums(const size_t t_Size1,
+                                                     const size_t t_Size2,
+                                                     std::vector<double> t_Wavelengths,
+                                                     std::vector<double> t_Sums) :
+        m_Size1(t_Size1),
+        m_Size2(t_Size2),
+        m_Wavelengths(std::move(t_Wavelengths)),
+        m_Sums(std::move(t_Sums))
+    {
+        assert(m_Sums.size() == (m_Wavelengths.size() + 1u) * m_Size1 * m_Size2);
+    }
+
+    std::vector<double> CMatrixSeriesPrefixSums::sumsOverRange(const double minLambda,
+                                                               const double maxLambda) const
+    {
+        const auto block{m_Size1 * m_Size2};
+
+        // Wavelengths are normally sorted and the range is one continuous run of indexes. Runs
+        // are still searched for so that the result is correct for any order of wavelengths.
+        std::vector<double> result(block, 0);
+        size_t k = 0u;
+        while(k < m_Wavelengths.size())
+        {
+            if(!isInSumRange(m_Wavelengths[k], minLambda, maxLambda))
+            {
+                ++k;
+                continue;
+            }
+
+            const auto start{k};
+            while(k < m_Wavelengths.size() && isInSumRange(m_Wavelengths[k], minLambda, maxLambda))
+            {
+                ++k;
+            }
+
+            const double * first{m_Sums.data() + start * block};
+            const double * last{m_Sums.data() + k * block};
+            for(size_t n = 0u; n < block; ++n)
+            {
+                result[n] += last[n] - first[n];
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::vector<double>>
+      CMatrixSeriesPrefixSums::getSums(const double minLambda,
+                                       const double maxLambda,
+                                       const std::vector<double> & t_ScaleValue) const
+    {
+        return scaledSums(m_Size1, m_Size2, sumsOverRange(minLambda, maxLambda), t_ScaleValue);
+    }
+
+    std::vector<std::vector<double>>
+      CMatrixSeriesPrefixSums::getSums(const double minLambda, const double maxLambda) const
+    {
+        const std::vector<double> scaleValue(m_Size2, 1);
+        return getSums(minLambda, maxLambda, scaleValue);
+    }
+
+    SquareMatrix
+      CMatrixSeriesPrefixSums::getSquaredMatrixSums(const double minLambda,
+                                                    const double maxLambda,
+                                                    const std::vector<double> & t_ScaleValue) const
+    {
+        return scaledSquaredMatrix(
+          m_Size1, m_Size2, sumsOverRange(minLambda, maxLambda), t_ScaleValue);
+    }
+
 }   // namespace FenestrationCommon
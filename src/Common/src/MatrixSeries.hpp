@@ -9,15 +9,19 @@ namespace FenestrationCommon
 {
     class CSeries;
     class SquareMatrix;
+    class CMatrixSeriesPrefixSums;
     enum class IntegrationType;
 
+    //! \brief Matrix of series that share the same wavelengths.
+    //!
+    //! Data are kept in one contiguous buffer arranged as [wavelength][i][j] so that every
+    //! operation over the matrix (multiplication with spectrum, interpolation, integration and
+    //! summation) is a single pass over memory.
     class CMatrixSeries
     {
     public:
         CMatrixSeries() = default;
         CMatrixSeries(size_t t_Size1, size_t t_Size2, size_t seriesSize = 0u);
-        CMatrixSeries(const CMatrixSeries & t_MatrixSeries);
-        CMatrixSeries & operator=(CMatrixSeries const & t_MatrixSeries);
 
         // add property at specific series position
         void addProperty(size_t i, size_t j, double t_Wavelength, double t_Value);
@@ -26,6 +30,7 @@ namespace FenestrationCommon
         void addProperties(double t_Wavelength, const SquareMatrix & t_Matrix);
         void setPropertiesAtIndex(size_t index, double t_Wavelength, const SquareMatrix & t_Matrix);
 
+        //! Series must have same wavelengths as the ones already stored in the matrix
         void addSeries(size_t i, size_t j, const CSeries & series);
 
         // Multiply all series in matrix with provided one
@@ -34,7 +39,8 @@ namespace FenestrationCommon
         // Multiplication of several series with matrix series
         void mMult(const std::vector<CSeries> & t_Series);
 
-        std::vector<CSeries> & operator[](size_t index);
+        //! Returns copy of series in the given row of the matrix
+        std::vector<CSeries> operator[](size_t index) const;
 
         void integrate(IntegrationType t_Integration,
                        double normalizationCoefficient,
@@ -48,17 +54,70 @@ namespace FenestrationCommon
         [[nodiscard]] std::vector<std::vector<double>> getSums(double minLambda,
                                                                double maxLambda) const;
 
-        SquareMatrix getSquaredMatrixSums(double minLambda,
-                                          double maxLambda,
-                                          const std::vector<double> & t_ScaleValue);
+        [[nodiscard]] SquareMatrix
+          getSquaredMatrixSums(double minLambda,
+                               double maxLambda,
+                               const std::vector<double> & t_ScaleValue) const;
+
+        //! Running sums of the series over wavelengths. Used when the same series needs to be
+        //! summed over many different wavelength ranges.
+        [[nodiscard]] CMatrixSeriesPrefixSums prefixSums() const;
 
         [[nodiscard]] size_t size1() const;
         [[nodiscard]] size_t size2() const;
 
+        [[nodiscard]] const std::vector<double> & getWavelengths() const;
+
+    private:
+        //! Index of the wavelength in the common wavelengths. Wavelength is added if it does not
+        //! exist.
+        size_t wavelengthIndex(double t_Wavelength);
+
+        [[nodiscard]] size_t blockSize() const;
+        [[nodiscard]] std::vector<double> sumsOverRange(double minLambda, double maxLambda) const;
+
+        size_t m_Size1{};
+        size_t m_Size2{};
+        std::vector<double> m_Wavelengths;
+        std::vector<double> m_Values;
+    };
+
+    //! \brief Running sums of the matrix series over wavelengths.
+    //!
+    //! Sum over any wavelength range is the difference of two running sums so it does not depend
+    //! on the number of wavelengths. Results match CMatrixSeries::getSums of the series this
+    //! object is created from up to rounding. The summation order differs, so an element can differ
+    //! by a few ulps of the running sum over the whole spectrum (relative tolerance of about 1e-12
+    //! of that sum is safe).
+    class CMatrixSeriesPrefixSums
+    {
+    public:
+        CMatrixSeriesPrefixSums() = default;
+        CMatrixSeriesPrefixSums(size_t t_Size1,
+                                size_t t_Size2,
+                                std::vector<double> t_Wavelengths,
+                                std::vector<double> t_Sums);
+
+        [[nodiscard]] std::vector<std::vector<double>> getSums(
+          double minLambda, double maxLambda, const std::vector<double> & t_ScaleValue) const;
+
+        [[nodiscard]] std::vector<std::vector<double>> getSums(double minLambda,
+                                                               double maxLambda) const;
+
+        [[nodiscard]] SquareMatrix
+          getSquaredMatrixSums(double minLambda,
+                               double maxLambda,
+                               const std::vector<double> & t_ScaleValue) const;
+
     private:
-        std::vector<std::vector<CSeries>> m_Matrix;
+        [[nodiscard]] std::vector<double> sumsOverRange(double minLambda, double maxLambda) const;
+
         size_t m_Size1{};
         size_t m_Size2{};
+        std::vector<double> m_Wavelengths;
+        //! Sum of all the values before wavelength k arranged as [k][i][j]. It has one more
+        //! wavelength block than the series so the last block is the total sum.
+        std::vector<double> m_Sums;
     };
 
 }   // namespace FenestrationCommon
@@ -1,5 +1,6 @@
 #include <stdexcept>
 #include <algorithm>
+#include <numeric>
 #include <cmath>
 
 #include "Series.hpp"
@@ -57,54 +58,104 @@ namespace FenestrationCommon
         return m_x < t_Point.m_x;
     }
 
+    /////////////////////////////////////////////////////
+    //  CSeries::const_iterator
+    /////////////////////////////////////////////////////
+
+    CSeries::const_iterator::const_iterator(const CSeries * t_Series, size_t t_Index) :
+        m_Series(t_Series),
+        m_Index(t_Index)
+    {}
+
+    CSeriesPoint CSeries::const_iterator::operator*() const
+    {
+        return {m_Series->m_x[m_Index], m_Series->m_Values[m_Index]};
+    }
+
+    CSeries::const_iterator & CSeries::const_iterator::operator++()
+    {
+        ++m_Index;
+        return *this;
+    }
+
+    CSeries::const_iterator CSeries::const_iterator::operator++(int)
+    {
+        auto result{*this};
+        ++m_Index;
+        return result;
+    }
+
+    bool CSeries::const_iterator::operator==(const const_iterator & other) const
+    {
+        return m_Series == other.m_Series && m_Index == other.m_Index;
+    }
+
+    bool CSeries::const_iterator::operator!=(const const_iterator & other) const
+    {
+        return !(*this == other);
+    }
+
     /////////////////////////////////////////////////////
     //  CSeries
     /////////////////////////////////////////////////////
 
-    CSeries::CSeries(size_t size) : m_Series(size)
+    CSeries::CSeries(size_t size) : m_x(size), m_Values(size)
     {}
 
     CSeries::CSeries(const std::vector<std::pair<double, double>> & t_values)
     {
-        // m_Series.clear();
+        m_x.reserve(t_values.size());
+        m_Values.reserve(t_values.size());
         for(auto & val : t_values)
         {
-            m_Series.emplace_back(val.first, val.second);
+            m_x.push_back(val.first);
+            m_Values.push_back(val.second);
         }
     }
 
     CSeries::CSeries(const std::initializer_list<std::pair<double, double>> & t_values)
     {
-        // m_Series.clear();
+        m_x.reserve(t_values.size());
+        m_Values.reserve(t_values.size());
         for(const auto & val : t_values)
         {
-            m_Series.emplace_back(val.first, val.second);
+            m_x.push_back(val.first);
+            m_Values.push_back(val.second);
+        }
+    }
+
+    CSeries::CSeries(std::vector<double> t_x, std::vector<double> t_Values) :
+        m_x(std::move(t_x)),
+        m_Values(std::move(t_Values))
+    {
+        if(m_x.size() != m_Values.size())
+        {
+            throw std::runtime_error("Series x and value arrays must be the same size.");
         }
     }
 
     void CSeries::addProperty(const double t_x, const double t_Value)
     {
-        m_Series.emplace_back(t_x, t_Value);
+        m_x.push_back(t_x);
+        m_Values.push_back(t_Value);
     }
 
     void CSeries::setPropertyAtIndex(size_t index, double x, double value)
     {
-        m_Series[index].setX(x);
-        m_Series[index].setValue(value);
+        m_x[index] = x;
+        m_Values[index] = value;
     }
 
     void CSeries::insertToBeginning(double t_x, double t_Value)
     {
-        m_Series.insert(m_Series.begin(), {t_x, t_Value});
+        m_x.insert(m_x.begin(), t_x);
+        m_Values.insert(m_Values.begin(), t_Value);
     }
 
     void CSeries::setConstantValues(const std::vector<double> & t_Wavelengths, double const t_Value)
     {
-        m_Series.clear();
-        for(auto it = t_Wavelengths.begin(); it < t_Wavelengths.end(); ++it)
-        {
-            addProperty((*it), t_Value);
-        }
+        m_x = t_Wavelengths;
+        m_Values.assign(t_Wavelengths.size(), t_Value);
     }
 
     CSeries CSeries::integrate(IntegrationType t_IntegrationType,
@@ -114,53 +165,41 @@ namespace FenestrationCommon
         const CIntegratorFactory aFactory = CIntegratorFactory();
         const auto aIntegrator = aFactory.getIntegrator(t_IntegrationType);
 
-        const auto series = integrationPoints.has_value()
-                              ? interpolate(integrationPoints.value()).m_Series
-                              : m_Series;
+        if(integrationPoints.has_value())
+        {
+            const auto series{interpolate(integrationPoints.value())};
+            return aIntegrator->integrate(series.m_x, series.m_Values, normalizationCoefficient);
+        }
 
-        return aIntegrator->integrate(series, normalizationCoefficient);
+        return aIntegrator->integrate(m_x, m_Values, normalizationCoefficient);
     }
 
-    std::optional<CSeriesPoint> CSeries::findLower(double const t_Wavelength) const
+    size_t CSeries::upperIndex(double const t_x, bool const t_Sorted) const
     {
-        std::optional<CSeriesPoint> currentProperty;
-
-        for(auto & spectralProperty : m_Series)
+        if(t_Sorted)
         {
-            if(spectralProperty.x() > t_Wavelength)
-            {
-                break;
-            }
-            currentProperty = spectralProperty;
+            return static_cast<size_t>(std::upper_bound(m_x.begin(), m_x.end(), t_x)
+                                       - m_x.begin());
         }
 
-        return currentProperty;
+        // Series that are not sorted keep behavior of sequential search
+        return static_cast<size_t>(
+          std::find_if(m_x.begin(), m_x.end(), [&](const double x) { return x > t_x; })
+          - m_x.begin());
     }
 
-    std::optional<CSeriesPoint> CSeries::findUpper(double const t_Wavelength) const
+    double CSeries::interpolateAtUpper(size_t const t_Upper, double const t_Wavelength) const
     {
-        std::optional<CSeriesPoint> currentProperty;
+        // Values outside of the range are extrapolated as constant from the nearest point
+        const auto upper{t_Upper < m_x.size() ? t_Upper : t_Upper - 1u};
+        const auto lower{t_Upper > 0u ? t_Upper - 1u : t_Upper};
 
-        for(auto & spectralProperty : m_Series)
-        {
-            if(spectralProperty.x() > t_Wavelength)
-            {
-                currentProperty = spectralProperty;
-                break;
-            }
-        }
-
-        return currentProperty;
+        return interpolate(m_x[lower], m_x[upper], m_Values[lower], m_Values[upper], t_Wavelength);
     }
 
-    double CSeries::interpolate(const CSeriesPoint & t_Lower,
-                                const CSeriesPoint & t_Upper,
-                                double const t_Wavelength)
+    double CSeries::interpolate(
+      const double w1, const double w2, const double v1, const double v2, double const t_Wavelength)
     {
-        double w1 = t_Lower.x();
-        double w2 = t_Upper.x();
-        double v1 = t_Lower.value();
-        double v2 = t_Upper.value();
         double vx = 0;
         if(w2 != w1)
         {
@@ -180,52 +219,74 @@ namespace FenestrationCommon
 
         if(size() != 0)
         {
-            std::optional<CSeriesPoint> lower;
-            std::optional<CSeriesPoint> upper;
+            newProperties.m_x = t_Wavelengths;
+            newProperties.m_Values.resize(t_Wavelengths.size());
 
-            for(double wavelength : t_Wavelengths)
-            {
-                lower = findLower(wavelength);
-                upper = findUpper(wavelength);
+            const auto sorted{std::is_sorted(m_x.begin(), m_x.end())};
 
-                if(!lower.has_value())
+            if(sorted && std::is_sorted(t_Wavelengths.begin(), t_Wavelengths.end()))
+            {
+                // Both arrays are sorted so single merge pass is enough
+                size_t upper{0u};
+                for(size_t i = 0u; i < t_Wavelengths.size(); ++i)
                 {
-                    lower = upper;
+                    const auto wavelength{t_Wavelengths[i]};
+                    while(upper < m_x.size() && m_x[upper] <= wavelength)
+                    {
+                        ++upper;
+                    }
+                    newProperties.m_Values[i] = interpolateAtUpper(upper, wavelength);
                 }
-
-                if(!upper.has_value())
+            }
+            else
+            {
+                for(size_t i = 0u; i < t_Wavelengths.size(); ++i)
                 {
-                    upper = lower;
+                    const auto wavelength{t_Wavelengths[i]};
+                    newProperties.m_Values[i] =
+                      interpolateAtUpper(upperIndex(wavelength, sorted), wavelength);
                 }
-
-                newProperties.addProperty(wavelength,
-                                          interpolate(lower.value(), upper.value(), wavelength));
             }
         }
 
         return newProperties;
     }
 
-    CSeries CSeries::operator*(const CSeries & other)
+    namespace
     {
-        CSeries newProperty;
-
         const double WAVELENGTHTOLERANCE = 1e-10;
 
-        size_t minSize = std::min(m_Series.size(), other.m_Series.size());
-
-        for(size_t i = 0; i < minSize; ++i)
+        bool sameWavelengths(const std::vector<double> & first,
+                             const std::vector<double> & second,
+                             const size_t size)
         {
-            double value = m_Series[i].value() * other.m_Series[i].value();
-            double wv = m_Series[i].x();
-            double testWv = other.m_Series[i].x();
-
-            if(std::abs(wv - testWv) > WAVELENGTHTOLERANCE)
+            for(size_t i = 0; i < size; ++i)
             {
-                throw std::runtime_error("The wavelengths of the two vectors are not the same. "
-                                         "Cannot perform multiplication.");
+                if(std::abs(first[i] - second[i]) > WAVELENGTHTOLERANCE)
+                {
+                    return false;
+                }
             }
-            newProperty.addProperty(wv, value);
+            return true;
+        }
+    }   // namespace
+
+    CSeries CSeries::operator*(const CSeries & other)
+    {
+        const size_t minSize = std::min(m_x.size(), other.m_x.size());
+
+        if(!sameWavelengths(m_x, other.m_x, minSize))
+        {
+            throw std::runtime_error("The wavelengths of the two vectors are not the same. "
+                                     "Cannot perform multiplication.");
+        }
+
+        CSeries newProperty;
+        newProperty.m_x.assign(m_x.begin(), m_x.begin() + minSize);
+        newProperty.m_Values.resize(minSize);
+        for(size_t i = 0; i < minSize; ++i)
+        {
+            newProperty.m_Values[i] = m_Values[i] * other.m_Values[i];
         }
 
         return newProperty;
@@ -233,24 +294,20 @@ namespace FenestrationCommon
 
     CSeries CSeries::operator-(const CSeries & t_Series) const
     {
-        const double WAVELENGTHTOLERANCE = 1e-10;
+        const size_t minSize = std::min(m_x.size(), t_Series.m_x.size());
 
-        CSeries newProperties;
-        size_t minSize = std::min(m_Series.size(), t_Series.m_Series.size());
+        if(!sameWavelengths(m_x, t_Series.m_x, minSize))
+        {
+            throw std::runtime_error(
+              "Wavelengths of two vectors are not the same. Cannot preform subtraction.");
+        }
 
+        CSeries newProperties;
+        newProperties.m_x.assign(m_x.begin(), m_x.begin() + minSize);
+        newProperties.m_Values.resize(minSize);
         for(size_t i = 0; i < minSize; ++i)
         {
-            double value = m_Series[i].value() - t_Series.m_Series[i].value();
-            double wv = m_Series[i].x();
-            double testWv = t_Series.m_Series[i].x();
-
-            if(std::abs(wv - testWv) > WAVELENGTHTOLERANCE)
-            {
-                throw std::runtime_error(
-                  "Wavelengths of two vectors are not the same. Cannot preform subtraction.");
-            }
-
-            newProperties.addProperty(wv, value);
+            newProperties.m_Values[i] = m_Values[i] - t_Series.m_Values[i];
         }
 
         return newProperties;
@@ -258,39 +315,31 @@ namespace FenestrationCommon
 
     CSeries operator-(const double val, const CSeries & other)
     {
-        CSeries newProperties;
-
-        for(const auto & ot : other)
+        auto values{other.getYArray()};
+        for(auto & value : values)
         {
-            double value = val - ot.value();
-            double wv = ot.x();
-
-            newProperties.addProperty(wv, value);
+            value = val - value;
         }
 
-        return newProperties;
+        return {other.getXArray(), std::move(values)};
     }
 
     CSeries CSeries::operator+(const CSeries & other) const
     {
-        const double WAVELENGTHTOLERANCE = 1e-10;
+        const size_t minSize = std::min(m_x.size(), other.m_x.size());
 
-        CSeries newProperties;
-        size_t minSize = std::min(m_Series.size(), other.m_Series.size());
+        if(!sameWavelengths(m_x, other.m_x, minSize))
+        {
+            throw std::runtime_error(
+              "Wavelengths of two vectors are not the same. Cannot preform addition.");
+        }
 
+        CSeries newProperties;
+        newProperties.m_x.assign(m_x.begin(), m_x.begin() + minSize);
+        newProperties.m_Values.resize(minSize);
         for(size_t i = 0; i < minSize; ++i)
         {
-            double value = m_Series[i].value() + other.m_Series[i].value();
-            double wv = m_Series[i].x();
-            double testWv = other.m_Series[i].x();
-
-            if(std::abs(wv - testWv) > WAVELENGTHTOLERANCE)
-            {
-                throw std::runtime_error(
-                  "Wavelengths of two vectors are not the same. Cannot preform addition.");
-            }
-
-            newProperties.addProperty(wv, value);
+            newProperties.m_Values[i] = m_Values[i] + other.m_Values[i];
         }
 
         return newProperties;
@@ -298,42 +347,33 @@ namespace FenestrationCommon
 
     std::vector<double> CSeries::getXArray() const
     {
-        std::vector<double> aArray;
-        for(auto & spectralProperty : m_Series)
-        {
-            aArray.push_back(spectralProperty.x());
-        }
-
-        return aArray;
+        return m_x;
     }
 
     std::vector<double> CSeries::getYArray() const
     {
-        std::vector<double> aArray;
-        for(auto & spectralProperty : m_Series)
-        {
-            aArray.push_back(spectralProperty.value());
-        }
+        return m_Values;
+    }
 
-        return aArray;
+    bool isInSumRange(const double x, const double minX, const double maxX)
+    {
+        double const TOLERANCE = 1e-6;   // introduced because of rounding error
+        // Last point must be excluded because of ranges. Each wavelength represent range from
+        // wavelength one to wavelength two. Summing value of the last wavelength in array would
+        // be wrong because it would include one additional range after the end of spectrum. For
+        // example, summing all the data from 0.38 to 0.78 would include visible range. However,
+        // including 0.78 in sum would add extra value from 0.78 to 0.79.
+        return (x >= (minX - TOLERANCE) && x < (maxX - TOLERANCE)) || (minX == 0 && maxX == 0);
     }
 
     double CSeries::sum(double const minLambda, double const maxLambda) const
     {
-        double const TOLERANCE = 1e-6;   // introduced because of rounding error
         double total = 0;
-        for(auto & aPoint : m_Series)
+        for(size_t i = 0u; i < m_x.size(); ++i)
         {
-            double wavelength = aPoint.x();
-            // Last point must be excluded because of ranges. Each wavelength represent range from
-            // wavelength one to wavelength two. Summing value of the last wavelength in array would
-            // be wrong because it would include one additional range after the end of spectrum. For
-            // example, summing all the data from 0.38 to 0.78 would include visible range. However,
-            // including 0.78 in sum would add extra value from 0.78 to 0.79.
-            if(((wavelength >= (minLambda - TOLERANCE) && wavelength < (maxLambda - TOLERANCE))
-                || (minLambda == 0 && maxLambda == 0)))
+            if(isInSumRange(m_x[i], minLambda, maxLambda))
             {
-                total += aPoint.value();
+                total += m_Values[i];
             }
         }
         return total;
@@ -341,59 +381,69 @@ namespace FenestrationCommon
 
     void CSeries::sort()
     {
-        std::sort(
-          m_Series.begin(),
-          m_Series.end(),
-          [](CSeriesPoint const & l, CSeriesPoint const & r) -> bool { return l.x() < r.x(); });
+        std::vector<size_t> index(m_x.size());
+        std::iota(index.begin(), index.end(), 0u);
+        std::stable_sort(index.begin(), index.end(), [&](const size_t l, const size_t r) {
+            return m_x[l] < m_x[r];
+        });
+
+        std::vector<double> x(m_x.size());
+        std::vector<double> values(m_Values.size());
+        for(size_t i = 0u; i < index.size(); ++i)
+        {
+            x[i] = m_x[index[i]];
+            values[i] = m_Values[index[i]];
+        }
+        m_x = std::move(x);
+        m_Values = std::move(values);
     }
 
-    std::vector<CSeriesPoint>::const_iterator CSeries::begin() const
+    CSeries::const_iterator CSeries::begin() const
     {
-        return m_Series.cbegin();
+        return {this, 0u};
     }
 
-    std::vector<CSeriesPoint>::const_iterator CSeries::end() const
+    CSeries::const_iterator CSeries::end() const
     {
-        return m_Series.cend();
+        return {this, m_x.size()};
     }
 
     size_t CSeries::size() const
     {
-        return m_Series.size();
+        return m_x.size();
     }
 
-    const CSeriesPoint & CSeries::operator[](size_t Index) const
+    CSeriesPoint CSeries::operator[](size_t Index) const
     {
-        if(Index >= m_Series.size())
+        if(Index >= m_x.size())
         {
             throw std::out_of_range("Index out of range.");
         }
-        return m_Series[Index];
+        return {m_x[Index], m_Values[Index]};
     }
 
     void CSeries::clear()
     {
-        m_Series.clear();
+        m_x.clear();
+        m_Values.clear();
     }
 
     void CSeries::cutExtraData(double minWavelength, double maxWavelength)
     {
-        std::vector<CSeriesPoint> result;
         const auto eps = 1e-8;
-        for(const auto & val : m_Series)
+        size_t current{0u};
+        for(size_t i = 0u; i < m_x.size(); ++i)
         {
-            if(val.x() > (minWavelength - eps) && val.x() < (maxWavelength + eps))
+            if(m_x[i] > (minWavelength - eps) && m_x[i] < (maxWavelength + eps))
             {
-                result.push_back(val);
+                m_x[current] = m_x[i];
+                m_Values[current] = m_Values[i];
+                ++current;
             }
         }
 
-        m_Series.clear();
-
-        for(const auto & val : result)
-        {
-            m_Series.push_back(val);
-        }
+        m_x.resize(current);
+        m_Values.resize(current);
     }
 
 }   // namespace FenestrationCommon
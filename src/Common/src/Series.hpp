@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <iterator>
 
 namespace FenestrationCommon
 {   // Implementation of spectral property interface
@@ -28,18 +29,44 @@ namespace FenestrationCommon
     enum class IntegrationType;
 
     // Spectral properties for certain range of data. It holds common behavior like integration and
-    // interpolation over certain range of data. class CSeries : public
-    // std::enable_shared_from_this< CSeries > {
+    // interpolation over certain range of data. Values are stored as two separate arrays (x values
+    // and property values) so that arithmetic and interpolation loops run over contiguous data.
     class CSeries
     {
     public:
+        //! Read only iterator over the series. Points are created on the fly from x and value
+        //! arrays.
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = CSeriesPoint;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = CSeriesPoint;
+
+            const_iterator(const CSeries * t_Series, size_t t_Index);
+
+            CSeriesPoint operator*() const;
+            const_iterator & operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator & other) const;
+            bool operator!=(const const_iterator & other) const;
+
+        private:
+            const CSeries * m_Series;
+            size_t m_Index;
+        };
+
         CSeries() = default;
 
         explicit CSeries (size_t size);
         explicit CSeries(const std::vector<std::pair<double, double>> & t_values);
         CSeries(const std::initializer_list<std::pair<double, double>> & t_values);
+        CSeries(std::vector<double> t_x, std::vector<double> t_Values);
 
         CSeries(const CSeries & t_Series) = default;
+        CSeries(CSeries && t_Series) = default;
         void addProperty(double t_x, double t_Value);
         void setPropertyAtIndex(size_t index, double x, double value);
         void insertToBeginning(double t_x, double t_Value);
@@ -51,6 +78,10 @@ namespace FenestrationCommon
                           double normalizationCoefficient = 1,
                           const std::optional<std::vector<double>> & integrationPoints = std::nullopt) const;
 
+        //! \brief Linear interpolation of the series to given wavelengths.
+        //!
+        //! Sorted wavelengths are interpolated in a single merge pass over the series. Unsorted
+        //! wavelengths use binary search for every value.
         [[nodiscard]] CSeries interpolate(const std::vector<double> & t_Wavelengths) const;
 
         //! \brief Multiplication of values in spectral properties that have same wavelength.
@@ -84,29 +115,34 @@ namespace FenestrationCommon
         // Sort series by x values in ascending order
         void sort();
 
-        [[nodiscard]] std::vector<CSeriesPoint>::const_iterator begin() const;
-        [[nodiscard]] std::vector<CSeriesPoint>::const_iterator end() const;
+        [[nodiscard]] const_iterator begin() const;
+        [[nodiscard]] const_iterator end() const;
         [[nodiscard]] size_t size() const;
 
         CSeries & operator=(const CSeries & t_Series) = default;
-        const CSeriesPoint & operator[](size_t Index) const;
+        CSeries & operator=(CSeries && t_Series) = default;
+        CSeriesPoint operator[](size_t Index) const;
 
         void clear();
 
         void cutExtraData(double minWavelength, double maxWavelength);
 
     private:
-        [[nodiscard]] std::optional<CSeriesPoint> findLower(double t_x) const;
-        [[nodiscard]] std::optional<CSeriesPoint> findUpper(double t_x) const;
-        static double interpolate(const CSeriesPoint & t_Lower,
-                                  const CSeriesPoint & t_Upper,
-                                  const double t_Wavelength);
+        //! Index of the first point with x greater than t_x (size() if there is no such point)
+        [[nodiscard]] size_t upperIndex(double t_x, bool t_Sorted) const;
+        [[nodiscard]] double interpolateAtUpper(size_t t_Upper, double t_Wavelength) const;
+        static double interpolate(double w1, double w2, double v1, double v2, double t_Wavelength);
 
-        std::vector<CSeriesPoint> m_Series;
+        std::vector<double> m_x;
+        std::vector<double> m_Values;
     };
 
     CSeries operator-(const double val, const CSeries & other);
 
+    //! True if value at given x belongs to the sum over [minX, maxX) range (see CSeries::sum).
+    //! Both limits equal to zero mean that every value belongs to the sum.
+    [[nodiscard]] bool isInSumRange(double x, double minX, double maxX);
+
 }   // namespace FenestrationCommon
 
 #endif
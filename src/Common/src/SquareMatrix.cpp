@@ -1,39 +1,118 @@
 #include <stdexcept>
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 
 #include "SquareMatrix.hpp"
+#include "LUFactorization.hpp"
 
 namespace FenestrationCommon
 {
-    SquareMatrix::SquareMatrix(const std::size_t tSize) :
-        m_size(tSize),
-        m_Matrix(tSize, std::vector<double>(tSize, 0))
+    namespace
+    {
+        // Tile size used by blocked kernels. Three tiles of 64 x 64 doubles fit into L2 cache of
+        // any reasonable CPU which is enough to keep full Klems basis (145 x 145) multiplication
+        // out of main memory.
+        constexpr std::size_t blockSize{64u};
+
+        //! Cache blocked kernel for C = A * B. Matrices are row-major and of size n x n. Summation
+        //! order over k is kept ascending so results are identical to the naive i-k-j loop.
+        void multiplyBlocked(const double * a, const double * b, double * c, const std::size_t n)
+        {
+            // Zero elements of A can be skipped only when B is finite. Otherwise 0 * NaN and
+            // 0 * Inf must give NaN in the result.
+            const auto skipZeros{
+              std::all_of(b, b + n * n, [](const double value) { return std::isfinite(value); })};
+
+            std::fill(c, c + n * n, 0.0);
+            for(std::size_t kk = 0u; kk < n; kk += blockSize)
+            {
+                const auto kMax{std::min(kk + blockSize, n)};
+                for(std::size_t jj = 0u; jj < n; jj += blockSize)
+                {
+                    const auto jMax{std::min(jj + blockSize, n)};
+                    for(std::size_t i = 0u; i < n; ++i)
+                    {
+                        double * cRow{c + i * n};
+                        const double * aRow{a + i * n};
+                        for(std::size_t k = kk; k < kMax; ++k)
+                        {
+                            const double aik{aRow[k]};
+                            // BSDF matrices are often diagonal (specular layers) or very sparse
+                            if(skipZeros && aik == 0.0)
+                            {
+                                continue;
+                            }
+                            const double * bRow{b + k * n};
+                            for(std::size_t j = jj; j < jMax; ++j)
+                            {
+                                cRow[j] += aik * bRow[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        //! res(i, j) = m(i, j) * d[i]
+        void scaleRows(const double * m, const double * d, double * res, const std::size_t n)
+        {
+            for(std::size_t i = 0u; i < n; ++i)
+            {
+                const double di{d[i]};
+                const double * mRow{m + i * n};
+                double * rRow{res + i * n};
+                for(std::size_t j = 0u; j < n; ++j)
+                {
+                    rRow[j] = mRow[j] * di;
+                }
+            }
+        }
+
+        //! res(i, j) = m(i, j) * d[j]
+        void scaleColumns(const double * m, const double * d, double * res, const std::size_t n)
+        {
+            for(std::size_t i = 0u; i < n; ++i)
+            {
+                const double * mRow{m + i * n};
+                double * rRow{res + i * n};
+                for(std::size_t j = 0u; j < n; ++j)
+                {
+                    rRow[j] = mRow[j] * d[j];
+                }
+            }
+        }
+    }   // namespace
+
+    SquareMatrix::SquareMatrix(const std::size_t tSize) : m_size(tSize), m_Matrix(tSize * tSize, 0)
     {}
 
     SquareMatrix::SquareMatrix(const std::initializer_list<std::vector<double>> & tInput) :
         m_size(tInput.size()),
-        m_Matrix(m_size, std::vector<double>(m_size, 0))
+        m_Matrix(m_size * m_size, 0)
     {
         auto i = 0u;
         for(const auto & vec : tInput)
         {
-            for(auto j = 0u; j < vec.size(); ++j)
-            {
-                m_Matrix[i][j] = vec[j];
-            }
+            const auto rowSize{std::min(vec.size(), m_size)};
+            std::copy(vec.begin(), vec.begin() + rowSize, m_Matrix.begin() + i * m_size);
             ++i;
         }
     }
 
     SquareMatrix::SquareMatrix(const std::vector<std::vector<double>> & tInput) :
         m_size(tInput.size()),
-        m_Matrix(tInput)
-    {}
+        m_Matrix(m_size * m_size, 0)
+    {
+        for(auto i = 0u; i < m_size; ++i)
+        {
+            const auto rowSize{std::min(tInput[i].size(), m_size)};
+            std::copy(tInput[i].begin(), tInput[i].begin() + rowSize, m_Matrix.begin() + i * m_size);
+        }
+    }
 
     SquareMatrix::SquareMatrix(const std::vector<std::vector<double>> && tInput) :
-        m_size(tInput.size()),
-        m_Matrix(tInput)
+        SquareMatrix(tInput)
     {}
 
     std::size_t SquareMatrix::size() const
@@ -43,7 +122,7 @@ namespace FenestrationCommon
 
     void SquareMatrix::setZeros()
     {
-        m_Matrix.assign(m_size, std::vector<double>(m_size, 0));
+        std::fill(m_Matrix.begin(), m_Matrix.end(), 0.0);
     }
 
     void SquareMatrix::setIdentity()
@@ -51,7 +130,7 @@ namespace FenestrationCommon
         setZeros();
         for(auto i = 0u; i < m_size; ++i)
         {
-            m_Matrix[i][i] = 1.0;
+            m_Matrix[i * m_size + i] = 1.0;
         }
     }
 
@@ -64,96 +143,37 @@ namespace FenestrationCommon
 
         for(auto i = 0u; i < m_size; ++i)
         {
-            m_Matrix[i][i] = tInput[i];
+            m_Matrix[i * m_size + i] = tInput[i];
         }
     }
 
-    // SquareMatrix::SquareMatrix(SquareMatrix && tMatrix) :
-    //    m_size(tMatrix.size()),
-    //    m_Matrix(std::move(tMatrix.m_Matrix))
-    //{}
-
     SquareMatrix SquareMatrix::inverse() const
     {
-        // return LU decomposed matrix of current matrix
-        auto aLu(LU());
-
-        // find the inverse
-        SquareMatrix invMat(m_size);
-        std::vector<double> d(m_size);
-        std::vector<double> y(m_size);
-
-        const auto size(m_size - 1);
-
-        for(auto m = 0u; m <= size; ++m)
-        {
-            fill(d.begin(), d.end(), 0);
-            fill(y.begin(), y.end(), 0);
-            d[m] = 1;
-            for(auto i = 0; i <= int(size); ++i)
-            {
-                double x = 0;
-                for(auto j = 0; j <= i - 1; ++j)
-                {
-                    x = x + aLu(size_t(i), size_t(j)) * y[j];
-                }
-                y[i] = (d[i] - x);
-            }
-
-            for(auto i = int(size); i >= 0; --i)
-            {
-                auto x = 0.0;
-                for(auto j = i + 1; j <= int(size); ++j)
-                {
-                    x = x + aLu(size_t(i), size_t(j)) * invMat(size_t(j), size_t(m));
-                }
-                invMat(size_t(i), size_t(m)) = (y[i] - x) / aLu(size_t(i), size_t(i));
-            }
-        }
-
-        return invMat;
+        return LUFactorization(*this).inverse();
     }
 
     double SquareMatrix::operator()(const std::size_t i, const std::size_t j) const
     {
-        return m_Matrix[i][j];
+        return m_Matrix[i * m_size + j];
     }
 
     double & SquareMatrix::operator()(const std::size_t i, const std::size_t j)
     {
-        return m_Matrix[i][j];
-    }
-
-    SquareMatrix SquareMatrix::LU() const
-    {
-        SquareMatrix D(this->m_Matrix);
-
-        for(auto k = 0u; k <= m_size - 2; ++k)
-        {
-            for(auto j = k + 1; j <= m_size - 1; ++j)
-            {
-                const auto x = D(j, k) / D(k, k);
-                for(auto i = k; i <= m_size - 1; ++i)
-                {
-                    D(j, i) = D(j, i) - x * D(k, i);
-                }
-                D(j, k) = x;
-            }
-        }
-
-        return D;
+        return m_Matrix[i * m_size + j];
     }
 
     std::vector<double> SquareMatrix::checkSingularity() const
     {
         std::vector<double> vv;
+        vv.reserve(m_size);
 
         for(auto i = 0u; i < m_size; ++i)
         {
             auto aamax = 0.0;
+            const double * row{m_Matrix.data() + i * m_size};
             for(size_t j = 0; j < m_size; ++j)
             {
-                const auto absCellValue = std::abs(m_Matrix[i][j]);
+                const auto absCellValue = std::abs(row[j]);
                 if(absCellValue > aamax)
                 {
                     aamax = absCellValue;
@@ -177,18 +197,18 @@ namespace FenestrationCommon
 
         std::vector<double> vv = checkSingularity();
 
-        auto d = 1;
+        auto & a{*this};
 
         for(auto j = 0u; j < m_size; ++j)
         {
             for(auto i = 0; i <= int(j - 1); ++i)
             {
-                auto sum = m_Matrix[i][j];
+                auto sum = a(i, j);
                 for(auto k = 0; k <= i - 1; ++k)
                 {
-                    sum = sum - m_Matrix[i][k] * m_Matrix[k][j];
+                    sum = sum - a(i, k) * a(k, j);
                 }
-                m_Matrix[i][j] = sum;
+                a(i, j) = sum;
             }
 
             auto aamax = 0.0;
@@ -196,12 +216,12 @@ namespace FenestrationCommon
 
             for(auto i = j; i < m_size; ++i)
             {
-                auto sum = m_Matrix[i][j];
+                auto sum = a(i, j);
                 for(auto k = 0; k <= int(j - 1); ++k)
                 {
-                    sum = sum - m_Matrix[i][k] * m_Matrix[k][j];
+                    sum = sum - a(i, k) * a(k, j);
                 }
-                m_Matrix[i][j] = sum;
+                a(i, j) = sum;
                 const auto dum = vv[i] * std::abs(sum);
                 if(dum >= aamax)
                 {
@@ -212,26 +232,22 @@ namespace FenestrationCommon
 
             if(int(j) != imax)
             {
-                for(auto k = 0u; k < m_size; ++k)
-                {
-                    const auto dum = m_Matrix[imax][k];
-                    m_Matrix[imax][k] = m_Matrix[j][k];
-                    m_Matrix[j][k] = dum;
-                }   // k
-                d = -d;
+                std::swap_ranges(m_Matrix.begin() + imax * m_size,
+                                 m_Matrix.begin() + (imax + 1) * m_size,
+                                 m_Matrix.begin() + j * m_size);
                 vv[imax] = vv[j];
             }
             index[j] = imax;
-            if(m_Matrix[j][j] == 0.0)
+            if(a(j, j) == 0.0)
             {
-                m_Matrix[j][j] = TINY;
+                a(j, j) = TINY;
             }
             if(j != (m_size - 1))
             {
-                const auto dum = 1.0 / m_Matrix[j][j];
+                const auto dum = 1.0 / a(j, j);
                 for(auto i = j + 1; i < m_size; ++i)
                 {
-                    m_Matrix[i][j] = m_Matrix[i][j] * dum;
+                    a(i, j) = a(i, j) * dum;
                 }   // i
             }
         }
@@ -248,16 +264,7 @@ namespace FenestrationCommon
 
         SquareMatrix aMatrix{first.size()};
 
-        for(size_t i = 0; i < aMatrix.size(); ++i)
-        {
-            for(size_t k = 0; k < aMatrix.size(); ++k)
-            {
-                for(size_t j = 0; j < aMatrix.size(); ++j)
-                {
-                    aMatrix(i, j) += first(i, k) * second(k, j);
-                }
-            }
-        }
+        multiplyBlocked(first.data(), second.data(), aMatrix.data(), aMatrix.size());
 
         return aMatrix;
     }
@@ -276,12 +283,13 @@ namespace FenestrationCommon
         }
 
         SquareMatrix aMatrix{first.size()};
-        for(size_t i = 0; i < aMatrix.size(); ++i)
+        const auto n{aMatrix.size() * aMatrix.size()};
+        const double * a{first.data()};
+        const double * b{second.data()};
+        double * c{aMatrix.data()};
+        for(size_t i = 0; i < n; ++i)
         {
-            for(size_t j = 0; j < aMatrix.size(); ++j)
-            {
-                aMatrix(i, j) = first(i, j) + second(i, j);
-            }
+            c[i] = a[i] + b[i];
         }
 
         return aMatrix;
@@ -301,12 +309,13 @@ namespace FenestrationCommon
         }
 
         SquareMatrix aMatrix(first.size());
-        for(size_t i = 0; i < aMatrix.size(); ++i)
+        const auto n{aMatrix.size() * aMatrix.size()};
+        const double * a{first.data()};
+        const double * b{second.data()};
+        double * c{aMatrix.data()};
+        for(size_t i = 0; i < n; ++i)
         {
-            for(size_t j = 0; j < aMatrix.size(); ++j)
-            {
-                aMatrix(i, j) = first(i, j) - second(i, j);
-            }
+            c[i] = a[i] - b[i];
         }
 
         return aMatrix;
@@ -326,22 +335,30 @@ namespace FenestrationCommon
         }
 
         SquareMatrix res{m_size};
-        for(auto i = 0u; i < m_size; ++i)
-        {
-            for(auto j = 0u; j < m_size; ++j)
-            {
-                res(j, i) = m_Matrix[j][i] * tInput[i];
-            }
-        }
+        scaleColumns(m_Matrix.data(), tInput.data(), res.data(), m_size);
 
         return res;
     }
 
     std::vector<std::vector<double>> SquareMatrix::getMatrix() const
     {
-        return m_Matrix;
+        std::vector<std::vector<double>> result(m_size);
+        for(auto i = 0u; i < m_size; ++i)
+        {
+            result[i].assign(m_Matrix.begin() + i * m_size, m_Matrix.begin() + (i + 1) * m_size);
+        }
+        return result;
     }
 
+    const double * SquareMatrix::data() const
+    {
+        return m_Matrix.data();
+    }
+
+    double * SquareMatrix::data()
+    {
+        return m_Matrix.data();
+    }
 
     std::vector<double> operator*(const std::vector<double> & first, const SquareMatrix & second)
     {
@@ -350,13 +367,18 @@ namespace FenestrationCommon
             throw std::runtime_error("Vector and matrix do not have same size.");
         }
 
-        std::vector<double> res(first.size(), 0);
+        const auto n{first.size()};
+        std::vector<double> res(n, 0);
+        const double * m{second.data()};
 
-        for(auto i = 0u; i < first.size(); ++i)
+        // Row oriented accumulation keeps inner loop contiguous
+        for(auto j = 0u; j < n; ++j)
         {
-            for(auto j = 0u; j < first.size(); ++j)
+            const double fj{first[j]};
+            const double * mRow{m + j * n};
+            for(auto i = 0u; i < n; ++i)
             {
-                res[i] += first[j] * second(j, i);
+                res[i] += fj * mRow[i];
             }
         }
 
@@ -370,14 +392,19 @@ namespace FenestrationCommon
             throw std::runtime_error("Vector and matrix do not have same size.");
         }
 
-        std::vector<double> res(second.size(), 0);
+        const auto n{second.size()};
+        std::vector<double> res(n, 0);
+        const double * m{first.data()};
 
-        for(auto i = 0u; i < second.size(); ++i)
+        for(auto i = 0u; i < n; ++i)
         {
-            for(auto j = 0u; j < second.size(); ++j)
+            const double * mRow{m + i * n};
+            double sum{0};
+            for(auto j = 0u; j < n; ++j)
             {
-                res[i] += second[j] * first(i, j);
+                sum += second[j] * mRow[j];
             }
+            res[i] = sum;
         }
 
         return res;
@@ -387,29 +414,16 @@ namespace FenestrationCommon
                                             const SquareMatrix & tMatrix)
     {
         SquareMatrix res{tInput.size()};
-        for(auto i = 0u; i < tInput.size(); ++i)
-        {
-            for(auto j = 0u; j < tInput.size(); ++j)
-            {
-                res(i, j) = tMatrix(i, j) * tInput[i];
-            }
-        }
+        scaleRows(tMatrix.data(), tInput.data(), res.data(), tInput.size());
         return res;
     }
 
     SquareMatrix multiplyWithDiagonalMatrix(const SquareMatrix & tMatrix,
-                                                                const std::vector<double> & tInput)
+                                            const std::vector<double> & tInput)
     {
         SquareMatrix res{tInput.size()};
-        for(auto i = 0u; i < tInput.size(); ++i)
-        {
-            for(auto j = 0u; j < tInput.size(); ++j)
-            {
-                res(i, j) = tMatrix(i, j) * tInput[j];
-            }
-        }
+        scaleColumns(tMatrix.data(), tInput.data(), res.data(), tInput.size());
         return res;
     }
 
-
 }   // namespace FenestrationCommon
@@ -2,9 +2,11 @@
 
 #include <vector>
 
+#include "AlignedAllocator.hpp"
+
 namespace FenestrationCommon
 {
-    // Works only with double
+    // Works only with double. Data are stored in a single row-major contiguous buffer.
     class SquareMatrix
     {
     public:
@@ -32,12 +34,14 @@ namespace FenestrationCommon
 
         [[nodiscard]] std::vector<std::vector<double>> getMatrix() const;
 
+        //! Raw access to row-major storage. Row i starts at data() + i * size().
+        [[nodiscard]] const double * data() const;
+        [[nodiscard]] double * data();
+
     private:
-        // explicit SquareMatrix(SquareMatrix && tMatrix);
-        SquareMatrix LU() const;
         std::vector<double> checkSingularity() const;
         std::size_t m_size;
-        std::vector<std::vector<double>> m_Matrix;
+        AlignedVector m_Matrix;
     };
 
     SquareMatrix operator*(const SquareMatrix & first, const SquareMatrix & second);
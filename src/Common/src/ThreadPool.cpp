@@ -0,0 +1,254 @@
+#include <atomic>
+#include <algorithm>
+#include <exception>
+
+#include "ThreadPool.hpp"
+#include "Utility.hpp"
+
+namespace FenestrationCommon
+{
+    namespace
+    {
+        size_t defaultNumberOfThreads()
+        {
+            // Compile time switch only sets the default. Number of threads can be changed at any
+            // time with ThreadPool::setNumberOfThreads.
+#if MULTITHREADING
+            return std::max(1u, std::thread::hardware_concurrency());
+#else
+            return 1u;
+#endif
+        }
+    }   // namespace
+
+    //! Chunks of one parallel loop. Any thread can take the next chunk from it.
+    struct ThreadPool::Batch
+    {
+        Batch(const RangeJob & t_Job, std::vector<IndexRange> t_Chunks) :
+            job(t_Job),
+            chunks(std::move(t_Chunks))
+        {}
+
+        //! Runs next chunk that is not taken. Returns false if there are no chunks left.
+        bool runNext()
+        {
+            const auto index{next.fetch_add(1u)};
+            if(index >= chunks.size())
+            {
+                return false;
+            }
+
+            try
+            {
+                job(chunks[index].start, chunks[index].end);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if(++finished == chunks.size())
+            {
+                done.notify_all();
+            }
+
+            return true;
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return finished == chunks.size(); });
+        }
+
+        const RangeJob & job;
+        const std::vector<IndexRange> chunks;
+        std::atomic<size_t> next{0u};
+
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t finished{0u};
+        std::exception_ptr exception;
+    };
+
+    ThreadPool & ThreadPool::instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ThreadPool::ThreadPool() : m_NumberOfThreads(defaultNumberOfThreads())
+    {}
+
+    ThreadPool::~ThreadPool()
+    {
+        stopWorkers();
+    }
+
+    void ThreadPool::setNumberOfThreads(const size_t numberOfThreads)
+    {
+        stopWorkers();
+        m_NumberOfThreads =
+          numberOfThreads == 0u ? std::max(1u, std::thread::hardware_concurrency()) : numberOfThreads;
+    }
+
+    size_t ThreadPool::numberOfThreads() const
+    {
+        return m_NumberOfThreads;
+    }
+
+    void ThreadPool::setExecutor(Executor t_Executor)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Executor = std::move(t_Executor);
+    }
+
+    Executor ThreadPool::executor()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Executor;
+    }
+
+    void ThreadPool::startWorkers()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        // Calling thread works on the loop as well so one worker less is needed
+        while(m_Workers.size() + 1u < m_NumberOfThreads)
+        {
+            m_Workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    void ThreadPool::stopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Condition.notify_all();
+
+        for(auto & worker : m_Workers)
+        {
+            worker.join();
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Workers.clear();
+        m_Stop = false;
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        while(true)
+        {
+            std::shared_ptr<Batch> batch;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [this] { return m_Stop || !m_Batches.empty(); });
+                if(m_Stop)
+                {
+                    return;
+                }
+                batch = m_Batches.front();
+            }
+
+            if(!batch->runNext())
+            {
+                removeBatch(batch);
+            }
+        }
+    }
+
+    void ThreadPool::removeBatch(const std::shared_ptr<Batch> & t_Batch)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const auto it{std::find(m_Batches.begin(), m_Batches.end(), t_Batch)};
+        if(it != m_Batches.end())
+        {
+            m_Batches.erase(it);
+        }
+    }
+
+    void ThreadPool::parallelFor(const size_t start, const size_t end, const RangeJob & t_Job)
+    {
+        if(end <= start)
+        {
+            return;
+        }
+
+        const auto numberOfChunks{std::min(m_NumberOfThreads, end - start)};
+        if(numberOfChunks == 1u)
+        {
+            t_Job(start, end);
+            return;
+        }
+
+        auto chunks{chunkIt(start, end - 1u, numberOfChunks)};
+
+        // Copy is used so that executor can be replaced while this loop is running
+        if(const auto aExecutor{executor()})
+        {
+            // Tasks must not throw since executor may run them on its own threads. First
+            // exception is kept and thrown once all the tasks are finished.
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+
+            std::vector<std::function<void()>> tasks;
+            for(const auto & chunk : chunks)
+            {
+                tasks.emplace_back([&t_Job, &exceptionMutex, &exception, chunk] {
+                    try
+                    {
+                        t_Job(chunk.start, chunk.end);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock(exceptionMutex);
+                        if(!exception)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+                });
+            }
+            aExecutor(tasks);
+
+            if(exception)
+            {
+                std::rethrow_exception(exception);
+            }
+            return;
+        }
+
+        startWorkers();
+
+        auto batch{std::make_shared<Batch>(t_Job, std::move(chunks))};
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Batches.push_back(batch);
+        }
+        m_Condition.notify_all();
+
+        while(batch->runNext())
+        {
+        }
+        removeBatch(batch);
+
+        batch->wait();
+
+        if(batch->exception)
+        {
+            std::rethrow_exception(batch->exception);
+        }
+    }
+
+    void parallel_for(const size_t start, const size_t end, const RangeJob & t_Job)
+    {
+        ThreadPool::instance().parallelFor(start, end, t_Job);
+    }
+}   // namespace FenestrationCommon
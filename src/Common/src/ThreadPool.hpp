@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace FenestrationCommon
+{
+    //! Job that processes indexes in [start, end) range
+    using RangeJob = std::function<void(size_t start, size_t end)>;
+
+    //! External executor. It must run all the tasks (in any order and on any threads) and return
+    //! only when every task is finished.
+    using Executor = std::function<void(const std::vector<std::function<void()>> & tasks)>;
+
+    //! \brief Process wide pool of worker threads.
+    //!
+    //! Workers are created once and reused by every parallel loop in the library. Range of the
+    //! loop is split into chunks which are taken by idle workers and by the calling thread itself,
+    //! so parallel loops can be nested without creating additional threads or blocking.
+    class ThreadPool
+    {
+    public:
+        static ThreadPool & instance();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool & operator=(const ThreadPool &) = delete;
+        ~ThreadPool();
+
+        //! Maximum number of threads used by parallel loops (calling thread included). Zero
+        //! means number of hardware threads and one means that loops run serially. Must not be
+        //! called while parallel loop is running.
+        void setNumberOfThreads(size_t numberOfThreads);
+        [[nodiscard]] size_t numberOfThreads() const;
+
+        //! Parallel loops will be executed by external executor instead of workers in the pool.
+        //! Empty executor sets back the pool workers. Exceptions thrown by the loop never reach
+        //! the executor. They are passed to the caller of parallelFor.
+        void setExecutor(Executor t_Executor);
+
+        void parallelFor(size_t start, size_t end, const RangeJob & t_Job);
+
+    private:
+        ThreadPool();
+
+        struct Batch;
+
+        void startWorkers();
+        void stopWorkers();
+        void workerLoop();
+        void removeBatch(const std::shared_ptr<Batch> & t_Batch);
+        [[nodiscard]] Executor executor();
+
+        size_t m_NumberOfThreads;
+        Executor m_Executor;
+
+        std::vector<std::thread> m_Workers;
+        std::deque<std::shared_ptr<Batch>> m_Batches;
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        bool m_Stop{false};
+    };
+
+    //! Runs job over [start, end) range using process wide thread pool
+    void parallel_for(size_t start, size_t end, const RangeJob & t_Job);
+}   // namespace FenestrationCommon
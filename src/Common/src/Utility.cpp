@@ -1,8 +1,8 @@
-#include <thread>
 #include <algorithm>
 
 #include "Utility.hpp"
 #include "Constants.hpp"
+#include "ThreadPool.hpp"
 
 namespace FenestrationCommon
 {
@@ -34,18 +34,31 @@ namespace FenestrationCommon
 
     size_t getNumberOfThreads(size_t numberOfJobs)
     {
-        size_t numberOfThreads{1u};
-#if MULTITHREADING
-        numberOfThreads = std::min<size_t>(std::thread::hardware_concurrency(), static_cast<size_t>(numberOfJobs));
-#endif
-        //static const size_t maxNumberOfThreads{32u};
-        //numberOfThreads = std::minimum(numberOfThreads, maxNumberOfThreads);
         static const size_t minNumberOfThreads{1u};
-        return std::max(minNumberOfThreads, numberOfThreads);
+        return std::max(minNumberOfThreads,
+                        std::min(ThreadPool::instance().numberOfThreads(), numberOfJobs));
     }
 
     bool isVacuum(double pressure)
     {
         return pressure <= ConstantsData::VACUUMPRESSURE;
     }
+
+    InstanceMutex::InstanceMutex(const InstanceMutex &)
+    {}
+
+    InstanceMutex & InstanceMutex::operator=(const InstanceMutex &)
+    {
+        return *this;
+    }
+
+    void InstanceMutex::lock()
+    {
+        m_Mutex.lock();
+    }
+
+    void InstanceMutex::unlock()
+    {
+        m_Mutex.unlock();
+    }
 }   // namespace FenestrationCommon
\ No newline at end of file
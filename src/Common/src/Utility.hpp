@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <mutex>
 
 namespace FenestrationCommon
 {
@@ -14,6 +15,8 @@ namespace FenestrationCommon
     //! Makes division for indexes that are defined from start to end for the purpose of multithreading.
     std::vector<IndexRange> chunkIt(size_t start, size_t end, size_t numberOfSplits);
 
+    //! Number of threads that will be used for given number of jobs. Maximum number of threads is
+    //! set through ThreadPool::setNumberOfThreads.
     size_t getNumberOfThreads(size_t numberOfJobs);
 
     template <typename Map>
@@ -24,4 +27,22 @@ namespace FenestrationCommon
     }
 
     [[nodiscard]] bool isVacuum(double pressure);
+
+    //! \brief Mutex that guards data of single object.
+    //!
+    //! Unlike std::mutex it can be a member of copyable class. Copy of the object gets its own
+    //! unlocked mutex since the lock belongs to the object and not to the data.
+    class InstanceMutex
+    {
+    public:
+        InstanceMutex() = default;
+        InstanceMutex(const InstanceMutex &);
+        InstanceMutex & operator=(const InstanceMutex &);
+
+        void lock();
+        void unlock();
+
+    private:
+        std::mutex m_Mutex;
+    };
 }
\ No newline at end of file
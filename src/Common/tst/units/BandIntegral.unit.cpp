@@ -0,0 +1,123 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+class TestBandIntegral : public testing::Test
+{
+private:
+    CSeries m_Series;
+    CSeries m_Weights;
+
+protected:
+    void SetUp() override
+    {
+        // part of ASTM E891-87 Table 1
+        m_Series.addProperty(0.40, 556);
+        m_Series.addProperty(0.41, 656.3);
+        m_Series.addProperty(0.42, 690.8);
+        m_Series.addProperty(0.43, 641.9);
+        m_Series.addProperty(0.44, 798.5);
+        m_Series.addProperty(0.45, 956.6);
+        m_Series.addProperty(0.46, 990);
+        m_Series.addProperty(0.47, 998);
+        m_Series.addProperty(0.48, 1046.1);
+        m_Series.addProperty(0.49, 1005.1);
+        m_Series.addProperty(0.50, 1026.7);
+
+        m_Weights.addProperty(0.40, 0.12);
+        m_Weights.addProperty(0.41, 0.23);
+        m_Weights.addProperty(0.42, 0.31);
+        m_Weights.addProperty(0.43, 0.45);
+        m_Weights.addProperty(0.44, 0.52);
+        m_Weights.addProperty(0.45, 0.57);
+        m_Weights.addProperty(0.46, 0.61);
+        m_Weights.addProperty(0.47, 0.66);
+        m_Weights.addProperty(0.48, 0.64);
+        m_Weights.addProperty(0.49, 0.59);
+        m_Weights.addProperty(0.50, 0.55);
+    }
+
+public:
+    [[nodiscard]] const CSeries & getSeries() const
+    {
+        return m_Series;
+    }
+
+    [[nodiscard]] const CSeries & getWeights() const
+    {
+        return m_Weights;
+    }
+};
+
+TEST_F(TestBandIntegral, CompareWithIntegratedSeriesSum)
+{
+    SCOPED_TRACE("Begin Test: Band integral compared to sum of integrated series.");
+
+    const auto & aSeries{getSeries()};
+
+    const std::vector<IntegrationType> types{IntegrationType::Rectangular,
+                                             IntegrationType::RectangularCentroid,
+                                             IntegrationType::Trapezoidal,
+                                             IntegrationType::TrapezoidalA,
+                                             IntegrationType::TrapezoidalB};
+
+    const double normalization{2};
+    const double minLambda{0.42};
+    const double maxLambda{0.47};
+
+    for(const auto type : types)
+    {
+        const auto expected{
+          aSeries.integrate(type, normalization).sum(minLambda, maxLambda)};
+
+        const BandIntegral aIntegral(
+          aSeries.getXArray(), type, normalization, minLambda, maxLambda);
+
+        EXPECT_NEAR(expected, aIntegral.integrate(aSeries.getYArray()), 1e-9);
+    }
+}
+
+TEST_F(TestBandIntegral, WeightedIntegral)
+{
+    SCOPED_TRACE("Begin Test: Weighted band integral.");
+
+    auto aSeries{getSeries()};
+    const auto & aWeights{getWeights()};
+
+    const auto type{IntegrationType::Trapezoidal};
+    const double minLambda{0.3};
+    const double maxLambda{0.8};
+
+    const auto expected{(aSeries * aWeights).integrate(type, 1).sum(minLambda, maxLambda)};
+
+    EXPECT_NEAR(expected,
+                weightedBandIntegral(aSeries, aWeights, type, 1, minLambda, maxLambda),
+                1e-9);
+
+    const BandIntegral aIntegral(aSeries.getXArray(), type, 1, minLambda, maxLambda);
+    const auto coefficients{aIntegral.weighted(aWeights.getYArray())};
+    const auto values{aSeries.getYArray()};
+
+    double result{0};
+    for(size_t i = 0u; i < coefficients.size(); ++i)
+    {
+        result += coefficients[i] * values[i];
+    }
+
+    EXPECT_NEAR(expected, result, 1e-9);
+}
+
+TEST_F(TestBandIntegral, SizeMismatch)
+{
+    SCOPED_TRACE("Begin Test: Band integral with values at wrong wavelengths.");
+
+    const auto & aSeries{getSeries()};
+
+    const BandIntegral aIntegral(
+      aSeries.getXArray(), IntegrationType::Trapezoidal, 1, 0.3, 0.8);
+
+    EXPECT_THROW(static_cast<void>(aIntegral.integrate({1, 2, 3})), std::runtime_error);
+}
@@ -0,0 +1,99 @@
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+class TestBandedMatrix : public testing::Test
+{
+protected:
+    void SetUp() override
+    {}
+};
+
+TEST_F(TestBandedMatrix, SolveHeatBalance)
+{
+    SCOPED_TRACE("Begin Test: Banded matrix - single layer heat balance.");
+
+    BandedMatrix aMatrix{4u, 3u, 3u};
+    const std::vector<std::vector<double>> aValues{{32817.2867004354, 1, 0, -32808.3972386696},
+                                                   {1.28054053432588, -1, 0, 0},
+                                                   {0, 0, -1, 1.26433319889839},
+                                                   {32808.3972386696, 0, -1, -32810.4664383299}};
+    for(size_t i = 0u; i < aValues.size(); ++i)
+    {
+        for(size_t j = 0u; j < aValues.size(); ++j)
+        {
+            aMatrix(i, j) = aValues[i][j];
+        }
+    }
+
+    std::vector<double> aVector = {3163.241853, -73.479324, -67.913411, -1070.271453};
+
+    aMatrix.factorize();
+    aMatrix.solve(aVector);
+
+    EXPECT_NEAR(303.040746, aVector[0], 1e-6);
+    EXPECT_NEAR(461.535283, aVector[1], 1e-6);
+    EXPECT_NEAR(451.057585, aVector[2], 1e-6);
+    EXPECT_NEAR(303.040507, aVector[3], 1e-6);
+}
+
+TEST_F(TestBandedMatrix, CompareWithDenseSolution)
+{
+    SCOPED_TRACE("Begin Test: Banded matrix - solution is the same as dense solution.");
+
+    const size_t size{12u};
+    const size_t lower{2u};
+    const size_t upper{3u};
+
+    BandedMatrix aBanded{size, lower, upper};
+    SquareMatrix aDense{size};
+    for(size_t i = 0u; i < size; ++i)
+    {
+        for(size_t j = (i > lower ? i - lower : 0u); j < std::min(size, i + upper + 1u); ++j)
+        {
+            // Small diagonal forces row exchanges during the factorization
+            const double value{i == j ? 0.01 * static_cast<double>(i % 3u)
+                                      : 1.0 + 0.1 * static_cast<double>(i)
+                                          - 0.3 * static_cast<double>(j)};
+            aBanded(i, j) = value;
+            aDense(i, j) = value;
+        }
+    }
+
+    std::vector<double> aVector(size);
+    for(size_t i = 0u; i < size; ++i)
+    {
+        aVector[i] = static_cast<double>(i) - 4.5;
+    }
+
+    const auto aCorrect{LUFactorization(aDense).solve(aVector)};
+
+    aBanded.factorize();
+    aBanded.solve(aVector);
+
+    for(size_t i = 0u; i < size; ++i)
+    {
+        EXPECT_NEAR(aCorrect[i], aVector[i], 1e-9);
+    }
+}
+
+TEST_F(TestBandedMatrix, ElementOutsideOfBand)
+{
+    SCOPED_TRACE("Begin Test: Banded matrix - element outside of the band.");
+
+    BandedMatrix aMatrix{6u, 1u, 2u};
+
+    EXPECT_NO_THROW(aMatrix(3, 2) = 1.0);
+    EXPECT_NO_THROW(aMatrix(3, 5) = 1.0);
+    EXPECT_THROW(aMatrix(3, 1) = 1.0, std::runtime_error);
+    EXPECT_THROW(aMatrix(0, 3) = 1.0, std::runtime_error);
+
+    const auto & aConstMatrix{aMatrix};
+    EXPECT_EQ(0.0, aConstMatrix(5, 0));
+    EXPECT_EQ(1.0, aConstMatrix(3, 5));
+}
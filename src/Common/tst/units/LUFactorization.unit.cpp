@@ -0,0 +1,114 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+class TestLUFactorization : public testing::Test
+{
+protected:
+    void SetUp() override
+    {}
+};
+
+TEST_F(TestLUFactorization, SolveVector)
+{
+    SCOPED_TRACE("Begin Test: LU factorization - solving single right hand side.");
+
+    SquareMatrix aMatrix{{32817.2867004354, 1, 0, -32808.3972386696},
+                         {1.28054053432588, -1, 0, 0},
+                         {0, 0, -1, 1.26433319889839},
+                         {32808.3972386696, 0, -1, -32810.4664383299}};
+
+    const LUFactorization aFactor(aMatrix);
+
+    std::vector<double> aVector = {3163.241853, -73.479324, -67.913411, -1070.271453};
+
+    auto aSolution = aFactor.solve(aVector);
+
+    EXPECT_NEAR(303.040746, aSolution[0], 1e-6);
+    EXPECT_NEAR(461.535283, aSolution[1], 1e-6);
+    EXPECT_NEAR(451.057585, aSolution[2], 1e-6);
+    EXPECT_NEAR(303.040507, aSolution[3], 1e-6);
+}
+
+TEST_F(TestLUFactorization, ZeroOnDiagonal)
+{
+    SCOPED_TRACE("Begin Test: LU factorization - matrix that requires pivoting.");
+
+    // Unpivoted elimination would divide by zero in the first step
+    SquareMatrix aMatrix{{0, 2, 1}, {1, 1, 1}, {2, 1, 0}};
+
+    const LUFactorization aFactor(aMatrix);
+
+    auto aSolution = aFactor.solve(std::vector<double>{7, 6, 4});
+
+    EXPECT_NEAR(1.0, aSolution[0], 1e-12);
+    EXPECT_NEAR(2.0, aSolution[1], 1e-12);
+    EXPECT_NEAR(3.0, aSolution[2], 1e-12);
+}
+
+TEST_F(TestLUFactorization, SolveMatrix)
+{
+    SCOPED_TRACE("Begin Test: LU factorization - multiple right hand sides.");
+
+    SquareMatrix aMatrix{{2.59, 1.48, 9.54, 4.16},
+                         {9.45, 7.25, 6.58, 4.95},
+                         {2.12, 5.36, 4.98, 8.23},
+                         {4.89, 1.11, 7.45, 3.26}};
+
+    SquareMatrix B{{1, 2, 0, 4}, {0, 1, 3, 0}, {5, 0, 1, 2}, {1, 1, 1, 1}};
+
+    const LUFactorization aFactor(aMatrix);
+
+    const auto X{aFactor.solve(B)};
+    const auto correct{aMatrix.inverse() * B};
+
+    const auto n{aMatrix.size()};
+    for(size_t i = 0; i < n; ++i)
+    {
+        for(size_t j = 0; j < n; ++j)
+        {
+            EXPECT_NEAR(correct(i, j), X(i, j), 1e-10);
+        }
+    }
+
+    // Multiplying back must reproduce right hand side
+    const auto AX{aMatrix * X};
+    for(size_t i = 0; i < n; ++i)
+    {
+        for(size_t j = 0; j < n; ++j)
+        {
+            EXPECT_NEAR(B(i, j), AX(i, j), 1e-10);
+        }
+    }
+}
+
+TEST_F(TestLUFactorization, SolveVectors)
+{
+    SCOPED_TRACE("Begin Test: LU factorization - list of right hand side vectors.");
+
+    SquareMatrix aMatrix{{2.59, 1.48, 9.54, 4.16},
+                         {9.45, 7.25, 6.58, 4.95},
+                         {2.12, 5.36, 4.98, 8.23},
+                         {4.89, 1.11, 7.45, 3.26}};
+
+    const std::vector<std::vector<double>> b{
+      {1, 0, 5, 1}, {2, 1, 0, 1}, {0, 3, 1, 1}, {4, 0, 2, 1}, {-1, 2, -3, 4}};
+
+    const LUFactorization aFactor(aMatrix);
+
+    const auto x{aFactor.solve(b)};
+
+    ASSERT_EQ(b.size(), x.size());
+    for(size_t k = 0u; k < b.size(); ++k)
+    {
+        const auto correct{aFactor.solve(b[k])};
+        ASSERT_EQ(correct.size(), x[k].size());
+        for(size_t i = 0u; i < correct.size(); ++i)
+        {
+            EXPECT_NEAR(correct[i], x[k][i], 1e-12);
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include <memory>
 #include <stdexcept>
+#include <cmath>
+#include <limits>
 #include <gtest/gtest.h>
 
 #include "WCECommon.hpp"
@@ -241,6 +243,25 @@ TEST_F(TestMatrixMultiplication, Test8)
     }
 }
 
+TEST_F(TestMatrixMultiplication, NonFiniteValues)
+{
+    SCOPED_TRACE("Begin Test: Test matrix multiplication with non finite values.");
+
+    const auto nan{std::numeric_limits<double>::quiet_NaN()};
+    const auto inf{std::numeric_limits<double>::infinity()};
+
+    const SquareMatrix a{{0, 1}, {2, 0}};
+    const SquareMatrix b{{nan, 1}, {3, inf}};
+
+    const auto mult = a * b;
+
+    // Zero elements of the first matrix must not hide non finite values of the second one
+    EXPECT_TRUE(std::isnan(mult(0, 0)));
+    EXPECT_EQ(inf, mult(0, 1));
+    EXPECT_TRUE(std::isnan(mult(1, 0)));
+    EXPECT_TRUE(std::isnan(mult(1, 1)));
+}
+
 TEST_F(TestMatrixMultiplication, TestMultRowsException)
 {
     SCOPED_TRACE("Begin Test: Test matrix mmultRow exception.");
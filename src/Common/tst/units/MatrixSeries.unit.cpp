@@ -1,5 +1,7 @@
 #include <memory>
 #include <vector>
+#include <cmath>
+#include <algorithm>
 #include <gtest/gtest.h>
 
 #include "WCECommon.hpp"
@@ -128,3 +130,106 @@ TEST_F(TestMatrixSeries, SetPropertiesAtIndex)
     EXPECT_NEAR(0.305, result1[index].x(), 1e-6);
     EXPECT_NEAR(2.8, result1[index].value(), 1e-6);
 }
+
+TEST_F(TestMatrixSeries, Integration)
+{
+    SCOPED_TRACE("Begin Test: Test matrix series integration against series integration.");
+
+    CMatrixSeries mat(getMatrix());
+
+    std::vector<CSeries> expected;
+    for(size_t i = 0; i < mat.size1(); ++i)
+    {
+        for(const auto & series : mat[i])
+        {
+            expected.push_back(series.integrate(IntegrationType::TrapezoidalA, 2));
+        }
+    }
+
+    mat.integrate(IntegrationType::TrapezoidalA, 2, std::nullopt);
+
+    for(size_t i = 0; i < mat.size1(); ++i)
+    {
+        const auto row{mat[i]};
+        for(size_t j = 0; j < mat.size2(); ++j)
+        {
+            const auto & correct{expected[i * mat.size2() + j]};
+            EXPECT_EQ(correct.size(), row[j].size());
+            for(size_t k = 0; k < correct.size(); ++k)
+            {
+                EXPECT_NEAR(correct[k].x(), row[j][k].x(), 1e-12);
+                EXPECT_NEAR(correct[k].value(), row[j][k].value(), 1e-12);
+            }
+        }
+    }
+}
+
+TEST_F(TestMatrixSeries, Interpolation)
+{
+    SCOPED_TRACE("Begin Test: Test matrix series interpolation against series interpolation.");
+
+    CMatrixSeries mat(getMatrix());
+
+    const std::vector<double> wavelengths{0.4, 0.475, 0.5, 0.58, 0.7};
+
+    std::vector<CSeries> expected;
+    for(size_t i = 0; i < mat.size1(); ++i)
+    {
+        for(const auto & series : mat[i])
+        {
+            expected.push_back(series.interpolate(wavelengths));
+        }
+    }
+
+    mat.interpolate(wavelengths);
+
+    EXPECT_EQ(wavelengths, mat.getWavelengths());
+
+    for(size_t i = 0; i < mat.size1(); ++i)
+    {
+        const auto row{mat[i]};
+        for(size_t j = 0; j < mat.size2(); ++j)
+        {
+            const auto & correct{expected[i * mat.size2() + j]};
+            EXPECT_EQ(correct.size(), row[j].size());
+            for(size_t k = 0; k < correct.size(); ++k)
+            {
+                EXPECT_NEAR(correct[k].value(), row[j][k].value(), 1e-12);
+            }
+        }
+    }
+}
+
+TEST_F(TestMatrixSeries, PrefixSums)
+{
+    SCOPED_TRACE("Begin Test: Test sums from running sums against matrix series sums.");
+
+    const auto & aMat = getMatrix();
+    const auto prefixSums{aMat.prefixSums()};
+
+    const std::vector<double> scaleFactors = {2, 4};
+    const std::vector<std::pair<double, double>> ranges{
+      {0.45, 0.65}, {0.5, 0.6}, {0.55, 0.55}, {0.3, 0.5}, {0, 0}};
+
+    // Range sums are differences of running sums so they match only up to rounding of the sum
+    // over the whole spectrum
+    const auto total{aMat.getSums(0.45, 0.65, scaleFactors)};
+    constexpr auto relativeTolerance{1e-12};
+
+    for(const auto & [minLambda, maxLambda] : ranges)
+    {
+        const auto correct{aMat.getSums(minLambda, maxLambda, scaleFactors)};
+        const auto sums{prefixSums.getSums(minLambda, maxLambda, scaleFactors)};
+
+        EXPECT_EQ(correct.size(), sums.size());
+        for(size_t i = 0; i < correct.size(); ++i)
+        {
+            for(size_t j = 0; j < correct[i].size(); ++j)
+            {
+                EXPECT_NEAR(correct[i][j],
+                            sums[i][j],
+                            relativeTolerance * std::max(1.0, std::abs(total[i][j])));
+            }
+        }
+    }
+}
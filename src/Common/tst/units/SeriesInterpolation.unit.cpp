@@ -95,3 +95,45 @@ TEST_F(TestSeriesInterpolation, TestInterpolation)
         EXPECT_NEAR(correctResults[i], aInterpolatedProperties[i].value(), 1e-6);
     }
 }
+
+TEST_F(TestSeriesInterpolation, TestUnsortedWavelengths)
+{
+    SCOPED_TRACE("Begin Test: Test interpolation to wavelengths that are not sorted.");
+
+    auto & aSpectralProperties = *getProperty();
+
+    const std::vector<double> wavelengths{0.495, 0.405, 0.460, 0.425, 0.480};
+
+    auto aInterpolatedProperties = aSpectralProperties.interpolate(wavelengths);
+
+    const std::vector<double> correctResults{1015.900, 606.150, 990.000, 666.350, 1046.100};
+
+    EXPECT_EQ(aInterpolatedProperties.size(), correctResults.size());
+
+    for(size_t i = 0; i < aInterpolatedProperties.size(); ++i)
+    {
+        EXPECT_NEAR(wavelengths[i], aInterpolatedProperties[i].x(), 1e-12);
+        EXPECT_NEAR(correctResults[i], aInterpolatedProperties[i].value(), 1e-6);
+    }
+}
+
+TEST_F(TestSeriesInterpolation, TestOutOfRange)
+{
+    SCOPED_TRACE("Begin Test: Test interpolation outside of the range of data.");
+
+    auto & aSpectralProperties = *getProperty();
+
+    const std::vector<double> wavelengths{0.3, 0.4, 0.5, 0.6};
+
+    auto aInterpolatedProperties = aSpectralProperties.interpolate(wavelengths);
+
+    // Values outside of the range are taken from the nearest point
+    const std::vector<double> correctResults{556, 556, 1026.7, 1026.7};
+
+    EXPECT_EQ(aInterpolatedProperties.size(), correctResults.size());
+
+    for(size_t i = 0; i < aInterpolatedProperties.size(); ++i)
+    {
+        EXPECT_NEAR(correctResults[i], aInterpolatedProperties[i].value(), 1e-6);
+    }
+}
@@ -0,0 +1,175 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+class TestThreadPool : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        // Restore defaults for other tests
+        ThreadPool::instance().setExecutor(nullptr);
+        ThreadPool::instance().setNumberOfThreads(0u);
+    }
+};
+
+TEST_F(TestThreadPool, EveryIndexProcessedOnce)
+{
+    SCOPED_TRACE("Begin Test: Parallel loop processes every index once.");
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+
+    const size_t size{1000u};
+    std::vector<int> counts(size, 0);
+
+    parallel_for(0u, size, [&](const size_t start, const size_t end) {
+        for(size_t i = start; i < end; ++i)
+        {
+            ++counts[i];
+        }
+    });
+
+    for(const auto count : counts)
+    {
+        EXPECT_EQ(1, count);
+    }
+}
+
+TEST_F(TestThreadPool, NestedLoops)
+{
+    SCOPED_TRACE("Begin Test: Nested parallel loops.");
+
+    ThreadPool::instance().setNumberOfThreads(3u);
+
+    const size_t outerSize{7u};
+    const size_t innerSize{50u};
+    std::vector<double> sums(outerSize, 0);
+
+    parallel_for(0u, outerSize, [&](const size_t start, const size_t end) {
+        for(size_t i = start; i < end; ++i)
+        {
+            std::vector<double> values(innerSize, 0);
+            parallel_for(0u, innerSize, [&](const size_t innerStart, const size_t innerEnd) {
+                for(size_t j = innerStart; j < innerEnd; ++j)
+                {
+                    values[j] = static_cast<double>(i * j);
+                }
+            });
+            sums[i] = std::accumulate(values.begin(), values.end(), 0.0);
+        }
+    });
+
+    for(size_t i = 0u; i < outerSize; ++i)
+    {
+        EXPECT_NEAR(static_cast<double>(i * innerSize * (innerSize - 1u) / 2u), sums[i], 1e-12);
+    }
+}
+
+TEST_F(TestThreadPool, ExceptionIsPropagated)
+{
+    SCOPED_TRACE("Begin Test: Exception thrown in the loop is passed to the caller.");
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+
+    EXPECT_THROW(parallel_for(0u,
+                              100u,
+                              [](const size_t start, const size_t) {
+                                  if(start == 0u)
+                                  {
+                                      throw std::runtime_error("Error in loop.");
+                                  }
+                              }),
+                 std::runtime_error);
+}
+
+TEST_F(TestThreadPool, SingleThread)
+{
+    SCOPED_TRACE("Begin Test: Single thread runs the whole range at once.");
+
+    ThreadPool::instance().setNumberOfThreads(1u);
+
+    EXPECT_EQ(1u, getNumberOfThreads(100u));
+
+    size_t numberOfCalls{0u};
+    parallel_for(0u, 100u, [&](const size_t start, const size_t end) {
+        EXPECT_EQ(0u, start);
+        EXPECT_EQ(100u, end);
+        ++numberOfCalls;
+    });
+
+    EXPECT_EQ(1u, numberOfCalls);
+}
+
+TEST_F(TestThreadPool, ExternalExecutor)
+{
+    SCOPED_TRACE("Begin Test: Loop is executed by external executor.");
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+
+    size_t numberOfTasks{0u};
+    ThreadPool::instance().setExecutor(
+      [&](const std::vector<std::function<void()>> & tasks) {
+          numberOfTasks += tasks.size();
+          for(const auto & task : tasks)
+          {
+              task();
+          }
+      });
+
+    std::atomic<size_t> total{0u};
+    parallel_for(0u, 100u, [&](const size_t start, const size_t end) {
+        for(size_t i = start; i < end; ++i)
+        {
+            total += i;
+        }
+    });
+
+    EXPECT_EQ(4u, numberOfTasks);
+    EXPECT_EQ(4950u, total.load());
+}
+
+TEST_F(TestThreadPool, ExternalExecutorException)
+{
+    SCOPED_TRACE("Begin Test: Exception thrown in executor task is passed to the caller.");
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+
+    // Executor runs tasks on its own threads where exception would terminate the program
+    size_t numberOfTasks{0u};
+    ThreadPool::instance().setExecutor(
+      [&](const std::vector<std::function<void()>> & tasks) {
+          std::vector<std::thread> threads;
+          for(const auto & task : tasks)
+          {
+              threads.emplace_back(task);
+          }
+          for(auto & thread : threads)
+          {
+              thread.join();
+          }
+          numberOfTasks += tasks.size();
+      });
+
+    std::atomic<size_t> numberOfChunks{0u};
+    EXPECT_THROW(parallel_for(0u,
+                              100u,
+                              [&](const size_t start, const size_t) {
+                                  ++numberOfChunks;
+                                  if(start == 0u)
+                                  {
+                                      throw std::runtime_error("Error in loop.");
+                                  }
+                              }),
+                 std::runtime_error);
+
+    // Exception in one task does not stop the other ones
+    EXPECT_EQ(4u, numberOfTasks);
+    EXPECT_EQ(4u, numberOfChunks.load());
+}
@@ -3,6 +3,7 @@
 #include "../src/Gas.hpp"
 #include "../src/GasData.hpp"
 #include "../src/GasItem.hpp"
+#include "../src/GasMixture.hpp"
 #include "../src/GasProperties.hpp"
 #include "../src/GasSetting.hpp"
 #include "../src/GasCreator.hpp"
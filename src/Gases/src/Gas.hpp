@@ -5,6 +5,7 @@
 #include "GasProperties.hpp"
 #include "GasCreator.hpp"
 #include "GasItem.hpp"
+#include "GasMixture.hpp"
 
 namespace Gases
 {
@@ -34,27 +35,14 @@ namespace Gases
         GasProperties getStandardPressureGasProperties();
         GasProperties getVacuumPressureGasProperties();
 
-        [[nodiscard]] double viscTwoGases(GasProperties const & t_Gas1Properties,
-                                          GasProperties const & t_Gas2Properties) const;
-        double viscDenomTwoGases(CGasItem & t_GasItem1, CGasItem & t_GasItem2) const;
-
-        [[nodiscard]] double lambdaPrimTwoGases(GasProperties const & t_Gas1Properties,
-                                                GasProperties const & t_Gas2Properties) const;
-        [[nodiscard]] double lambdaSecondTwoGases(GasProperties const & t_Gas1Properties,
-                                                  GasProperties const & t_Gas2Properties) const;
-
-        double lambdaPrimDenomTwoGases(CGasItem & t_GasItem1, CGasItem & t_GasItem2) const;
-        double lambdaSecondDenomTwoGases(CGasItem & t_GasItem1, CGasItem & t_GasItem2) const;
-
-        std::vector<std::vector<double>> calculateMiItems();
-        std::pair<std::vector<std::vector<double>>, std::vector<std::vector<double>>>
-          calculateLambdaItems();
-
         std::vector<CGasItem> m_GasItem;
+        //! Mixing rules prepared for current gas items
+        CGasMixture m_Mixture;
         GasProperties m_SimpleProperties;
         GasProperties m_Properties;
 
         bool m_DefaultGas{true};
+        double m_Temperature{DefaultTemperature};
         double m_Pressure{DefaultPressure};
     };
 
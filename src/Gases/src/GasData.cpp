@@ -33,6 +33,11 @@ namespace Gases
         return m_Coefficients.at(t_Type).interpolationValue(t_Temperature);
     }
 
+    CIntCoeff CGasData::coefficients(CoeffType const t_Type) const
+    {
+        return m_Coefficients.at(t_Type);
+    }
+
     double CGasData::getSpecificHeatRatio() const
     {
         return m_specificHeatRatio;
@@ -23,6 +23,7 @@ namespace Gases
 
         [[nodiscard]] double getMolecularWeight() const;
         [[nodiscard]] double getPropertyValue(CoeffType t_Type, double t_Temperature) const;
+        [[nodiscard]] CIntCoeff coefficients(CoeffType t_Type) const;
         [[nodiscard]] double getSpecificHeatRatio() const;
         [[nodiscard]] std::string name() const;
 
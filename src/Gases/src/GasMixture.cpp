@@ -0,0 +1,306 @@
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "WCECommon.hpp"
+#include "GasMixture.hpp"
+#include "GasItem.hpp"
+#include "GasData.hpp"
+#include "GasExcept.hpp"
+
+namespace Gases
+{
+    namespace
+    {
+        //! Largest number of Chebyshev interpolation nodes that will be tried in approximation
+        const size_t maxChebyshevNodes{256u};
+
+        //! Mixtures with up to this number of items keep per item values on the stack
+        constexpr size_t stackItems{8u};
+
+        double relativeError(const double t_Approximated, const double t_Exact)
+        {
+            return std::abs(t_Approximated - t_Exact)
+                   / std::max(std::abs(t_Exact), std::numeric_limits<double>::min());
+        }
+    }   // namespace
+
+    CGasMixture::CGasMixture(const std::vector<CGasItem> & t_Items) : m_Size(t_Items.size())
+    {
+        for(const auto & item : t_Items)
+        {
+            const auto gasData{item.gasData()};
+            m_Fraction.push_back(item.fraction());
+            m_MolecularWeight.push_back(gasData.getMolecularWeight());
+            m_Conductivity.push_back(gasData.coefficients(CoeffType::cCond));
+            m_Viscosity.push_back(gasData.coefficients(CoeffType::cVisc));
+            m_SpecificHeat.push_back(gasData.coefficients(CoeffType::cCp));
+        }
+
+        const auto pairs{m_Size * m_Size};
+        m_FractionRatio.resize(pairs, 0);
+        m_ViscosityWeight.resize(pairs, 0);
+        m_ConductivityWeight.resize(pairs, 0);
+        m_Denominator.resize(pairs, 0);
+        m_ConductivityFactor.resize(pairs, 0);
+
+        // Invalid values (zero fractions or molecular weights) are reported with the same
+        // exceptions as in CGas, but only when properties are calculated
+        for(size_t i = 0u; i < m_Size; ++i)
+        {
+            for(size_t j = 0u; j < m_Size; ++j)
+            {
+                if(i == j)
+                {
+                    continue;
+                }
+                const auto ij{i * m_Size + j};
+                const auto & M1{m_MolecularWeight[i]};
+                const auto & M2{m_MolecularWeight[j]};
+                const auto weightFraction{M1 / M2};
+
+                m_FractionRatio[ij] = m_Fraction[j] / m_Fraction[i];
+                // Equations 63 and 68 (ISO 15099)
+                m_ViscosityWeight[ij] = pow(1 / weightFraction, 0.25);
+                m_ConductivityWeight[ij] = pow(weightFraction, 0.25);
+                m_Denominator[ij] = 2 * sqrt(2.0) * pow(1 + weightFraction, 0.5);
+                // Equation 66 (ISO 15099)
+                m_ConductivityFactor[ij] =
+                  1 + 2.41 * ((M1 - M2) * (M1 - 0.142 * M2) / pow((M1 + M2), 2));
+            }
+        }
+    }
+
+    GasProperties CGasMixture::properties(const double t_Temperature,
+                                          const double t_Pressure) const
+    {
+        using ConstantsData::UNIVERSALGASCONSTANT;
+
+        const auto approximated{!m_Chebyshev.empty() && t_Temperature >= m_MinTemperature
+                                && t_Temperature <= m_MaxTemperature};
+        const auto transport{approximated ? approximatedProperties(t_Temperature)
+                                          : transportProperties(t_Temperature)};
+
+        double molecularWeight{0};
+        double density{0};
+        for(size_t i = 0u; i < m_Size; ++i)
+        {
+            molecularWeight += m_MolecularWeight[i] * m_Fraction[i];
+            density += t_Pressure * m_MolecularWeight[i]
+                       / (UNIVERSALGASCONSTANT * t_Temperature) * m_Fraction[i];
+        }
+
+        GasProperties result;
+        result.m_ThermalConductivity = transport.conductivity;
+        result.m_Viscosity = transport.viscosity;
+        result.m_SpecificHeat = transport.specificHeat / molecularWeight;
+        result.m_Density = density;
+        result.m_MolecularWeight = molecularWeight;
+        result.m_PrandlNumber = calculatePrandtlNumber(
+          result.m_ThermalConductivity, result.m_SpecificHeat, result.m_Viscosity, result.m_Density);
+
+        return result;
+    }
+
+    void CGasMixture::approximate(const double t_MinTemperature,
+                                  const double t_MaxTemperature,
+                                  const double t_Tolerance)
+    {
+        using ConstantsData::WCE_PI;
+
+        if(t_MaxTemperature <= t_MinTemperature)
+        {
+            throw std::runtime_error(
+              "Maximum temperature must be greater than minimum temperature.");
+        }
+
+        m_MinTemperature = t_MinTemperature;
+        m_MaxTemperature = t_MaxTemperature;
+        const auto middle{(t_MaxTemperature + t_MinTemperature) / 2};
+        const auto halfRange{(t_MaxTemperature - t_MinTemperature) / 2};
+
+        for(size_t nodes = 4u; nodes <= maxChebyshevNodes; nodes *= 2u)
+        {
+            std::vector<TransportProperties> values(nodes);
+            for(size_t j = 0u; j < nodes; ++j)
+            {
+                const auto theta{WCE_PI * (static_cast<double>(j) + 0.5)
+                                 / static_cast<double>(nodes)};
+                values[j] = transportProperties(middle + halfRange * std::cos(theta));
+            }
+
+            m_Chebyshev.assign(nodes, TransportProperties());
+            for(size_t k = 0u; k < nodes; ++k)
+            {
+                auto & coefficient{m_Chebyshev[k]};
+                for(size_t j = 0u; j < nodes; ++j)
+                {
+                    const auto theta{WCE_PI * (static_cast<double>(j) + 0.5)
+                                     / static_cast<double>(nodes)};
+                    const auto weight{std::cos(static_cast<double>(k) * theta) * 2
+                                      / static_cast<double>(nodes)};
+                    coefficient.conductivity += weight * values[j].conductivity;
+                    coefficient.viscosity += weight * values[j].viscosity;
+                    coefficient.specificHeat += weight * values[j].specificHeat;
+                }
+            }
+            m_Chebyshev[0].conductivity /= 2;
+            m_Chebyshev[0].viscosity /= 2;
+            m_Chebyshev[0].specificHeat /= 2;
+
+            m_ApproximationError = 0;
+            const auto checkPoints{10u * nodes};
+            for(size_t i = 0u; i <= checkPoints; ++i)
+            {
+                const auto temperature{t_MinTemperature
+                                       + (t_MaxTemperature - t_MinTemperature)
+                                           * static_cast<double>(i)
+                                           / static_cast<double>(checkPoints)};
+                const auto exact{transportProperties(temperature)};
+                const auto approximated{approximatedProperties(temperature)};
+                m_ApproximationError =
+                  std::max({m_ApproximationError,
+                            relativeError(approximated.conductivity, exact.conductivity),
+                            relativeError(approximated.viscosity, exact.viscosity),
+                            relativeError(approximated.specificHeat, exact.specificHeat)});
+            }
+
+            if(m_ApproximationError <= t_Tolerance)
+            {
+                return;
+            }
+        }
+
+        m_Chebyshev.clear();
+        throw std::runtime_error("Gas properties cannot be approximated with given tolerance.");
+    }
+
+    double CGasMixture::approximationError() const
+    {
+        return m_ApproximationError;
+    }
+
+    CGasMixture::TransportProperties
+      CGasMixture::transportProperties(const double t_Temperature) const
+    {
+        // Viscosity, primary and secondary thermal conductivity of every item
+        std::array<double, 3u * stackItems> stackValues;
+        std::vector<double> heapValues;
+        auto * viscosity{stackValues.data()};
+        if(m_Size > stackItems)
+        {
+            heapValues.resize(3u * m_Size);
+            viscosity = heapValues.data();
+        }
+        auto * lambdaPr{viscosity + m_Size};
+        auto * lambdaSe{lambdaPr + m_Size};
+
+        TransportProperties result;
+        for(size_t i = 0u; i < m_Size; ++i)
+        {
+            viscosity[i] = m_Viscosity[i].interpolationValue(t_Temperature);
+            lambdaPr[i] = lambdaPrim(m_MolecularWeight[i], viscosity[i]);
+            lambdaSe[i] = lambdaSecond(m_MolecularWeight[i],
+                                       viscosity[i],
+                                       m_Conductivity[i].interpolationValue(t_Temperature));
+            result.specificHeat += m_SpecificHeat[i].interpolationValue(t_Temperature)
+                                   * m_Fraction[i] * m_MolecularWeight[i];
+        }
+
+        checkPairs(viscosity, lambdaPr);
+
+        double lambdaPrimMix{0};
+        double lambdaSecondMix{0};
+        for(size_t i = 0u; i < m_Size; ++i)
+        {
+            // Denominators of equations 62, 65 and 67 (ISO 15099)
+            auto sumViscosity{1.0};
+            auto sumLambdaPrim{1.0};
+            auto sumLambdaSecond{1.0};
+            for(size_t j = 0u; j < m_Size; ++j)
+            {
+                if(i == j)
+                {
+                    continue;
+                }
+                const auto ij{i * m_Size + j};
+                const auto phiViscosity{
+                  pow((1 + pow(viscosity[i] / viscosity[j], 0.5) * m_ViscosityWeight[ij]), 2)
+                  / m_Denominator[ij]};
+                const auto phiLambda{
+                  pow((1 + pow(lambdaPr[i] / lambdaPr[j], 0.5) * m_ConductivityWeight[ij]), 2)
+                  / m_Denominator[ij]};
+                sumViscosity += m_FractionRatio[ij] * phiViscosity;
+                sumLambdaPrim += m_FractionRatio[ij] * (phiLambda * m_ConductivityFactor[ij]);
+                sumLambdaSecond += m_FractionRatio[ij] * phiLambda;
+            }
+
+            result.viscosity += viscosity[i] / sumViscosity;
+            lambdaPrimMix += lambdaPr[i] / sumLambdaPrim;
+            lambdaSecondMix += lambdaSe[i] / sumLambdaSecond;
+        }
+        result.conductivity = lambdaPrimMix + lambdaSecondMix;
+
+        return result;
+    }
+
+    CGasMixture::TransportProperties
+      CGasMixture::approximatedProperties(const double t_Temperature) const
+    {
+        // Clenshaw recurrence
+        const auto x{(2 * t_Temperature - m_MinTemperature - m_MaxTemperature)
+                     / (m_MaxTemperature - m_MinTemperature)};
+        TransportProperties b1;
+        TransportProperties b2;
+        for(size_t k = m_Chebyshev.size() - 1u; k > 0u; --k)
+        {
+            const TransportProperties b0{
+              2 * x * b1.conductivity - b2.conductivity + m_Chebyshev[k].conductivity,
+              2 * x * b1.viscosity - b2.viscosity + m_Chebyshev[k].viscosity,
+              2 * x * b1.specificHeat - b2.specificHeat + m_Chebyshev[k].specificHeat};
+            b2 = b1;
+            b1 = b0;
+        }
+
+        return {x * b1.conductivity - b2.conductivity + m_Chebyshev[0].conductivity,
+                x * b1.viscosity - b2.viscosity + m_Chebyshev[0].viscosity,
+                x * b1.specificHeat - b2.specificHeat + m_Chebyshev[0].specificHeat};
+    }
+
+    void CGasMixture::checkPairs(const double * t_Viscosity, const double * t_LambdaPrim) const
+    {
+        for(size_t i = 0u; i < m_Size; ++i)
+        {
+            for(size_t j = 0u; j < m_Size; ++j)
+            {
+                if(i == j)
+                {
+                    continue;
+                }
+                if(t_Viscosity[i] == 0 || t_Viscosity[j] == 0)
+                {
+                    throw ZeroViscosityError();
+                }
+                if(m_MolecularWeight[i] == 0 || m_MolecularWeight[j] == 0)
+                {
+                    throw ZeroMolecularWeightError();
+                }
+                if(m_Denominator[i * m_Size + j] == 0)
+                {
+                    throw ZeroDynamicalViscosityError();
+                }
+                if(m_Fraction[i] == 0 || m_Fraction[j] == 0)
+                {
+                    throw ZeroGasFractionError();
+                }
+                if(t_LambdaPrim[i] == 0 || t_LambdaPrim[j] == 0)
+                {
+                    throw ZeroPrimaryThermalConductivityCoefficientError();
+                }
+            }
+        }
+    }
+
+}   // namespace Gases
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include "GasProperties.hpp"
+
+namespace Gases
+{
+    class CGasItem;
+
+    //! \brief Gas mixture prepared for repeated evaluation of properties.
+    //!
+    //! Fractions, coefficients and the parts of the ISO 15099 mixing rules (equations 62 to 68)
+    //! that do not depend on temperature are calculated once, at construction. Results are the
+    //! same as the ones calculated by CGas.
+    class CGasMixture
+    {
+    public:
+        CGasMixture() = default;
+        explicit CGasMixture(const std::vector<CGasItem> & t_Items);
+
+        //! Mixture properties when gas pressure is above vacuum pressure
+        [[nodiscard]] GasProperties properties(double t_Temperature, double t_Pressure) const;
+
+        //! Thermal conductivity, viscosity and specific heat inside given temperature range will
+        //! be calculated from Chebyshev polynomials. Degree of polynomials is increased until
+        //! relative error of every property is below tolerance. Error is checked on a grid that
+        //! is ten times denser than interpolation nodes. Temperatures outside of the range are
+        //! calculated from the mixing rules.
+        void approximate(double t_MinTemperature, double t_MaxTemperature, double t_Tolerance);
+
+        //! Maximum relative error of approximation measured when approximation was created
+        [[nodiscard]] double approximationError() const;
+
+    private:
+        struct TransportProperties
+        {
+            double conductivity{0};
+            double viscosity{0};
+            double specificHeat{0};
+        };
+
+        [[nodiscard]] TransportProperties transportProperties(double t_Temperature) const;
+        [[nodiscard]] TransportProperties approximatedProperties(double t_Temperature) const;
+
+        void checkPairs(const double * t_Viscosity, const double * t_LambdaPrim) const;
+
+        size_t m_Size{0u};
+        std::vector<double> m_Fraction;
+        std::vector<double> m_MolecularWeight;
+        std::vector<CIntCoeff> m_Conductivity;
+        std::vector<CIntCoeff> m_Viscosity;
+        std::vector<CIntCoeff> m_SpecificHeat;
+
+        // Temperature independent parts of the mixing rules. Item (i, j) is stored at i * size + j.
+        std::vector<double> m_FractionRatio;
+        std::vector<double> m_ViscosityWeight;
+        std::vector<double> m_ConductivityWeight;
+        std::vector<double> m_Denominator;
+        std::vector<double> m_ConductivityFactor;
+
+        double m_MinTemperature{0};
+        double m_MaxTemperature{0};
+        double m_ApproximationError{0};
+        //! Chebyshev coefficients for conductivity, viscosity and specific heat
+        std::vector<TransportProperties> m_Chebyshev;
+    };
+
+}   // namespace Gases
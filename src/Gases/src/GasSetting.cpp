@@ -3,8 +3,17 @@
 
 namespace Gases
 {
+    namespace
+    {
+        thread_local CGasSettings * threadSettings{nullptr};
+    }   // namespace
+
     CGasSettings & CGasSettings::instance()
     {
+        if(threadSettings != nullptr)
+        {
+            return *threadSettings;
+        }
         static CGasSettings p_inst;
         return p_inst;
     }
@@ -22,4 +31,17 @@ namespace Gases
     CGasSettings::CGasSettings() : m_VacuumPressure(ConstantsData::VACUUMPRESSURE)
     {}
 
+    CGasSettings::ThreadOverride::ThreadOverride(const double t_VacuumPressure) :
+        m_Settings(new CGasSettings()),
+        m_Previous(threadSettings)
+    {
+        m_Settings->setVacuumPressure(t_VacuumPressure);
+        threadSettings = m_Settings.get();
+    }
+
+    CGasSettings::ThreadOverride::~ThreadOverride()
+    {
+        threadSettings = m_Previous;
+    }
+
 }   // namespace Gases
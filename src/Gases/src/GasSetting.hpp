@@ -1,15 +1,35 @@
 #pragma once
 
+#include <memory>
+
 namespace Gases
 {
     class CGasSettings
     {
     public:
+        //! Returns settings of the current thread if they are overridden, otherwise process-wide
+        //! settings
         static CGasSettings & instance();
 
         [[nodiscard]] double getVacuumPressure() const;
         void setVacuumPressure(double t_Value);
 
+        //! Overrides settings for the current thread while the object exists. It allows
+        //! calculations with different settings to run at the same time.
+        class ThreadOverride
+        {
+        public:
+            explicit ThreadOverride(double t_VacuumPressure);
+            ~ThreadOverride();
+
+            ThreadOverride(const ThreadOverride &) = delete;
+            ThreadOverride & operator=(const ThreadOverride &) = delete;
+
+        private:
+            std::unique_ptr<CGasSettings> m_Settings;
+            CGasSettings * m_Previous;
+        };
+
     private:
         CGasSettings();
 
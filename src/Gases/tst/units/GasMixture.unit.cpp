@@ -0,0 +1,157 @@
+#include <tuple>
+#include <chrono>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "WCEGases.hpp"
+
+using Gases::CGas;
+using Gases::CGasItem;
+using Gases::CGasMixture;
+using Gases::GasDef;
+
+class TestGasMixture : public testing::Test
+{
+protected:
+    static std::vector<CGasItem> quadrupleGas()
+    {
+        return {{0.1, GasDef::Air}, {0.3, GasDef::Argon}, {0.3, GasDef::Krypton}, {0.3, GasDef::Xenon}};
+    }
+};
+
+TEST_F(TestGasMixture, SameAsGas)
+{
+    SCOPED_TRACE("Begin Test: Gas mixture compared to gas properties.");
+
+    const CGasMixture aMixture(quadrupleGas());
+    CGas aGas(quadrupleGas());
+
+    for(const auto temperature : {250.0, 273.15, 300.0, 345.5})
+    {
+        aGas.setTemperatureAndPressure(temperature, 101325);
+        const auto expected{aGas.getGasProperties()};
+        const auto properties{aMixture.properties(temperature, 101325)};
+
+        EXPECT_EQ(expected.m_ThermalConductivity, properties.m_ThermalConductivity);
+        EXPECT_EQ(expected.m_Viscosity, properties.m_Viscosity);
+        EXPECT_EQ(expected.m_SpecificHeat, properties.m_SpecificHeat);
+        EXPECT_EQ(expected.m_Density, properties.m_Density);
+        EXPECT_EQ(expected.m_MolecularWeight, properties.m_MolecularWeight);
+        EXPECT_EQ(expected.m_PrandlNumber, properties.m_PrandlNumber);
+    }
+
+    const auto aProperties{aMixture.properties(300, 101325)};
+    EXPECT_NEAR(79.4114, aProperties.m_MolecularWeight, 0.0001);
+    EXPECT_NEAR(1.108977555E-02, aProperties.m_ThermalConductivity, 1e-6);
+    EXPECT_NEAR(2.412413749E-05, aProperties.m_Viscosity, 1e-6);
+    EXPECT_NEAR(272.5637141, aProperties.m_SpecificHeat, 0.001);
+    EXPECT_NEAR(3.225849103, aProperties.m_Density, 0.0001);
+    EXPECT_NEAR(0.592921334, aProperties.m_PrandlNumber, 0.0001);
+}
+
+TEST_F(TestGasMixture, ChebyshevApproximation)
+{
+    SCOPED_TRACE("Begin Test: Gas mixture properties approximated with Chebyshev polynomials.");
+
+    const CGasMixture exactMixture(quadrupleGas());
+    CGasMixture aMixture(quadrupleGas());
+
+    const auto tolerance{1e-10};
+    aMixture.approximate(200, 400, tolerance);
+    EXPECT_LE(aMixture.approximationError(), tolerance);
+
+    for(const auto temperature : {200.0, 233.3, 273.15, 300.0, 361.7, 400.0})
+    {
+        const auto exact{exactMixture.properties(temperature, 101325)};
+        const auto approximated{aMixture.properties(temperature, 101325)};
+
+        EXPECT_NEAR(exact.m_ThermalConductivity,
+                    approximated.m_ThermalConductivity,
+                    tolerance * exact.m_ThermalConductivity);
+        EXPECT_NEAR(exact.m_Viscosity, approximated.m_Viscosity, tolerance * exact.m_Viscosity);
+        EXPECT_NEAR(
+          exact.m_SpecificHeat, approximated.m_SpecificHeat, tolerance * exact.m_SpecificHeat);
+        EXPECT_EQ(exact.m_Density, approximated.m_Density);
+    }
+
+    // Outside of approximation range properties are calculated from mixing rules
+    const auto exact{exactMixture.properties(450, 101325)};
+    const auto outside{aMixture.properties(450, 101325)};
+    EXPECT_EQ(exact.m_ThermalConductivity, outside.m_ThermalConductivity);
+    EXPECT_EQ(exact.m_Viscosity, outside.m_Viscosity);
+
+    EXPECT_THROW(aMixture.approximate(400, 200, tolerance), std::runtime_error);
+}
+
+TEST_F(TestGasMixture, ZeroGasFraction)
+{
+    SCOPED_TRACE("Begin Test: Gas mixture with zero gas fraction.");
+
+    const CGasMixture aMixture({{0, GasDef::Air}, {1, GasDef::Argon}});
+    EXPECT_THROW(std::ignore = aMixture.properties(300, 101325), Gases::ZeroGasFractionError);
+}
+
+TEST_F(TestGasMixture, ManyItems)
+{
+    SCOPED_TRACE("Begin Test: Gas mixture with many items of the same gas.");
+
+    // Mixing rules give pure gas properties when gas is split into several equal items
+    const CGasMixture pureGas({{1, GasDef::Argon}});
+    const std::vector<CGasItem> splitArgon(10u, {0.1, GasDef::Argon});
+    const CGasMixture aMixture(splitArgon);
+
+    const auto expected{pureGas.properties(300, 101325)};
+    const auto properties{aMixture.properties(300, 101325)};
+
+    EXPECT_NEAR(expected.m_ThermalConductivity, properties.m_ThermalConductivity, 1e-14);
+    EXPECT_NEAR(expected.m_Viscosity, properties.m_Viscosity, 1e-16);
+    EXPECT_NEAR(expected.m_SpecificHeat, properties.m_SpecificHeat, 1e-9);
+    EXPECT_NEAR(expected.m_Density, properties.m_Density, 1e-12);
+}
+
+// Micro-benchmark of gas properties calculations. Test is disabled by default since it is only
+// measuring time. Run it with --gtest_also_run_disabled_tests --gtest_filter=TestGasMixture.*
+TEST_F(TestGasMixture, DISABLED_PropertiesThroughput)
+{
+    SCOPED_TRACE("Begin Test: Gas properties throughput.");
+
+    const size_t numberOfRuns{200000u};
+    const auto temperature = [](const size_t i) {
+        return 250.0 + static_cast<double>(i % 1000u) * 0.1;
+    };
+
+    CGas aGas(quadrupleGas());
+    double sum{0};
+    auto start{std::chrono::steady_clock::now()};
+    for(size_t i = 0u; i < numberOfRuns; ++i)
+    {
+        aGas.setTemperatureAndPressure(temperature(i), 101325);
+        sum += aGas.getGasProperties().m_ThermalConductivity;
+    }
+    const std::chrono::duration<double> gasTime{std::chrono::steady_clock::now() - start};
+
+    const CGasMixture exactMixture(quadrupleGas());
+    start = std::chrono::steady_clock::now();
+    for(size_t i = 0u; i < numberOfRuns; ++i)
+    {
+        sum += exactMixture.properties(temperature(i), 101325).m_ThermalConductivity;
+    }
+    const std::chrono::duration<double> exactTime{std::chrono::steady_clock::now() - start};
+
+    CGasMixture approximatedMixture(quadrupleGas());
+    approximatedMixture.approximate(200, 400, 1e-10);
+    start = std::chrono::steady_clock::now();
+    for(size_t i = 0u; i < numberOfRuns; ++i)
+    {
+        sum += approximatedMixture.properties(temperature(i), 101325).m_ThermalConductivity;
+    }
+    const std::chrono::duration<double> approximatedTime{std::chrono::steady_clock::now()
+                                                         - start};
+
+    std::cout << "Quadruple gas properties (calls/s): CGas " << numberOfRuns / gasTime.count()
+              << ", CGasMixture " << numberOfRuns / exactTime.count()
+              << ", CGasMixture (Chebyshev) " << numberOfRuns / approximatedTime.count()
+              << std::endl;
+
+    EXPECT_GT(sum, 0.0);
+}
@@ -1,8 +1,6 @@
 
 #include <cmath>
 
-#include <thread>
-
 #include "EquivalentBSDFLayer.hpp"
 #include "EquivalentBSDFLayerSingleBand.hpp"
 
@@ -118,82 +116,107 @@ namespace MultiLayerOptics
             }
         }
 
+        // Layers are calculating all wavelengths at once before wavelength by wavelength loop
+        for(const auto & layer : m_Layer)
+        {
+            layer->calculateDirectionsAtWavelengths();
+        }
+
+        calculateJSCPrime();
+        calculateFactoredResults();
         calculateWavelengthByWavelengthProperties();
 
         m_Calculated = true;
     }
 
-    void CEquivalentBSDFLayer::calculateWavelengthByWavelengthProperties()
+    void CEquivalentBSDFLayer::calculateJSCPrime()
     {
-        const auto numberOfThreads{
-          FenestrationCommon::getNumberOfThreads(m_CombinedLayerWavelengths.size())};
-
-        const auto chunks{
-          FenestrationCommon::chunkIt(0u, m_CombinedLayerWavelengths.size() - 1u, numberOfThreads)};
-
-        std::vector<std::thread> workers;
-
-        for(const auto & chunk : chunks)
+        m_JSCPrime.clear();
+        m_JSCPrime.reserve(m_Layer.size());
+        for(const auto & layer : m_Layer)
         {
-            workers.emplace_back([&]() {
-                for(size_t index = chunk.start; index < chunk.end; ++index)
-                {
-                    auto layer{getEquivalentLayerAtWavelength(index)};
-                    for(auto aSide : FenestrationCommon::EnumSide())
-                    {
-                        const auto numberOfLayers{m_Layer.size()};
-                        for(size_t layerNumber = 0; layerNumber < numberOfLayers; ++layerNumber)
-                        {
-                            auto totA{layer.getLayerAbsorptances(layerNumber + 1, aSide)};
-
-                            m_TotA.at(aSide).setPropertiesAtIndex(
-                              index, layerNumber, m_CombinedLayerWavelengths[index], totA);
-
-                            auto totJSC{layer.getLayerJSC(layerNumber + 1, aSide)};
-                            m_TotJSC.at(aSide).setPropertiesAtIndex(
-                              index, layerNumber, m_CombinedLayerWavelengths[index], totJSC);
-                        }
-                        for(auto aProperty : FenestrationCommon::EnumPropertySimple())
-                        {
-                            auto tot{layer.getProperty(aSide, aProperty)};
-
-                            m_Tot.at({aSide, aProperty})
-                              .setPropertiesAtIndex(index, m_CombinedLayerWavelengths[index], tot);
-                        }
-                    }
-                }
-            });
+            std::map<Side, std::vector<std::vector<double>>> jscPrime;
+            for(auto aSide : FenestrationCommon::EnumSide())
+            {
+                jscPrime[aSide] = layer->jscPrime(aSide, m_CombinedLayerWavelengths);
+            }
+            m_JSCPrime.push_back(std::move(jscPrime));
         }
+    }
 
-        for(auto & worker : workers)
+    void CEquivalentBSDFLayer::calculateFactoredResults()
+    {
+        m_FactoredResults.clear();
+        m_FactoredResults.reserve(m_Layer.size());
+        for(const auto & layer : m_Layer)
         {
-            worker.join();
+            m_FactoredResults.push_back(layer->getFactoredResults());
         }
     }
 
+    void CEquivalentBSDFLayer::calculateWavelengthByWavelengthProperties()
+    {
+        FenestrationCommon::parallel_for(
+          0u, m_CombinedLayerWavelengths.size(), [&](const size_t start, const size_t end) {
+              for(size_t index = start; index < end; ++index)
+              {
+                  auto layer{getEquivalentLayerAtWavelength(index)};
+                  for(auto aSide : FenestrationCommon::EnumSide())
+                  {
+                      const auto numberOfLayers{m_Layer.size()};
+                      for(size_t layerNumber = 0; layerNumber < numberOfLayers; ++layerNumber)
+                      {
+                          auto totA{layer.getLayerAbsorptances(layerNumber + 1, aSide)};
+
+                          m_TotA.at(aSide).setPropertiesAtIndex(
+                            index, layerNumber, m_CombinedLayerWavelengths[index], totA);
+
+                          auto totJSC{layer.getLayerJSC(layerNumber + 1, aSide)};
+                          m_TotJSC.at(aSide).setPropertiesAtIndex(
+                            index, layerNumber, m_CombinedLayerWavelengths[index], totJSC);
+                      }
+                      for(auto aProperty : FenestrationCommon::EnumPropertySimple())
+                      {
+                          auto tot{layer.getProperty(aSide, aProperty)};
+
+                          m_Tot.at({aSide, aProperty})
+                            .setPropertiesAtIndex(index, m_CombinedLayerWavelengths[index], tot);
+                      }
+                  }
+              }
+          });
+    }
+
     CEquivalentBSDFLayerSingleBand
       CEquivalentBSDFLayer::getEquivalentLayerAtWavelength(size_t wavelengthIndex) const
     {
-        auto jscPrimeFront{m_Layer[0]->jscPrime(Side::Front, m_CombinedLayerWavelengths)};
-        auto jscPrimeBack{m_Layer[0]->jscPrime(Side::Back, m_CombinedLayerWavelengths)};
-        auto layerWLResults{m_Layer[0]->getResultsAtWavelength(wavelengthIndex)};
-
-
         CEquivalentBSDFLayerSingleBand result{
-          layerWLResults, jscPrimeFront[wavelengthIndex], jscPrimeBack[wavelengthIndex]};
+          getLayerResultsAtWavelength(0u, wavelengthIndex),
+          m_JSCPrime[0].at(Side::Front)[wavelengthIndex],
+          m_JSCPrime[0].at(Side::Back)[wavelengthIndex]};
 
         for(size_t i = 1u; i < m_Layer.size(); ++i)
         {
-            jscPrimeFront = m_Layer[i]->jscPrime(Side::Front, m_CombinedLayerWavelengths);
-            jscPrimeBack = m_Layer[i]->jscPrime(Side::Back, m_CombinedLayerWavelengths);
-            result.addLayer(m_Layer[i]->getResultsAtWavelength(wavelengthIndex),
-                            jscPrimeFront[wavelengthIndex],
-                            jscPrimeBack[wavelengthIndex]);
+            result.addLayer(getLayerResultsAtWavelength(i, wavelengthIndex),
+                            m_JSCPrime[i].at(Side::Front)[wavelengthIndex],
+                            m_JSCPrime[i].at(Side::Back)[wavelengthIndex]);
         }
 
         return result;
     }
 
+    SingleLayerOptics::BSDFIntegrator
+      CEquivalentBSDFLayer::getLayerResultsAtWavelength(size_t layerIndex,
+                                                        size_t wavelengthIndex) const
+    {
+        const auto & factored{m_FactoredResults[layerIndex]};
+        if(factored.has_value())
+        {
+            return factored->at(wavelengthIndex);
+        }
+        return m_Layer[layerIndex]->getResultsAtWavelength(wavelengthIndex);
+    }
+
     std::vector<double> CEquivalentBSDFLayer::unionOfLayerWavelengths(
       const std::vector<std::shared_ptr<SingleLayerOptics::CBSDFLayer>> & t_Layer)
     {
@@ -2,6 +2,7 @@
 #define EQUIVALENTBSDFLAYERMULTIWL_H
 
 #include <memory>
+#include <optional>
 #include <vector>
 #include <map>
 
@@ -52,6 +53,9 @@ namespace MultiLayerOptics
         [[nodiscard]] CEquivalentBSDFLayerSingleBand
           getEquivalentLayerAtWavelength(size_t wavelengthIndex) const;
 
+        [[nodiscard]] SingleLayerOptics::BSDFIntegrator
+          getLayerResultsAtWavelength(size_t layerIndex, size_t wavelengthIndex) const;
+
         static std::vector<double> unionOfLayerWavelengths(
           const std::vector<std::shared_ptr<SingleLayerOptics::CBSDFLayer>> & t_Layer);
 
@@ -73,11 +77,23 @@ namespace MultiLayerOptics
                  FenestrationCommon::CMatrixSeries>
           m_Tot;
 
+        // Photovoltaic current coefficients of every layer. They are calculated for all
+        // wavelengths at once so it is done before wavelength by wavelength calculations. Indexing
+        // is [layer][side] -> [wavelength][direction]
+        std::vector<std::map<FenestrationCommon::Side, std::vector<std::vector<double>>>>
+          m_JSCPrime;
+
+        // Layer results in factored form (geometry and material separated) for the layers that
+        // support it. Matrices for these layers are created only when wavelength is processed.
+        std::vector<std::optional<SingleLayerOptics::BSDFFactoredResults>> m_FactoredResults;
+
         FenestrationCommon::SquareMatrix m_Lambda;
 
         std::vector<double> m_CombinedLayerWavelengths;
         bool m_Calculated;
 
+        void calculateJSCPrime();
+        void calculateFactoredResults();
         void calculateWavelengthByWavelengthProperties();
     };
 
@@ -10,16 +10,20 @@ namespace MultiLayerOptics
     SquareMatrix interReflectance(const std::vector<double> & t_Lambda,
                                   const SquareMatrix & t_Rb,
                                   const SquareMatrix & t_Rf)
+    {
+        return interReflectanceFactor(t_Lambda, t_Rb, t_Rf).inverse();
+    }
+
+    LUFactorization interReflectanceFactor(const std::vector<double> & t_Lambda,
+                                           const SquareMatrix & t_Rb,
+                                           const SquareMatrix & t_Rf)
     {
         const auto size = t_Lambda.size();
         const auto lRb = multiplyWithDiagonalMatrix(t_Lambda, t_Rb);
         const auto lRf = multiplyWithDiagonalMatrix(t_Lambda, t_Rf);
-        auto InterRefl = lRb * lRf;
         SquareMatrix I(size);
         I.setIdentity();
-        InterRefl = I - InterRefl;
-        InterRefl = InterRefl.inverse();
-        return InterRefl;
+        return LUFactorization(I - lRb * lRf);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,14 +33,16 @@ namespace MultiLayerOptics
     CBSDFDoubleLayer::CBSDFDoubleLayer(const BSDFIntegrator & t_FrontLayer,
                                        const BSDFIntegrator & t_BackLayer)
     {
-        const auto aLambda = t_FrontLayer.lambdaVector();
-        const auto InterRefl1 = interReflectance(aLambda,
-                                                 t_FrontLayer.at(Side::Back, PropertySimple::R),
-                                                 t_BackLayer.at(Side::Front, PropertySimple::R));
+        const auto & aLambda = t_FrontLayer.lambdaVector();
+        const auto InterRefl1 =
+          interReflectanceFactor(aLambda,
+                                 t_FrontLayer.at(Side::Back, PropertySimple::R),
+                                 t_BackLayer.at(Side::Front, PropertySimple::R));
 
-        const auto InterRefl2 = interReflectance(aLambda,
-                                                 t_BackLayer.at(Side::Front, PropertySimple::R),
-                                                 t_FrontLayer.at(Side::Back, PropertySimple::R));
+        const auto InterRefl2 =
+          interReflectanceFactor(aLambda,
+                                 t_BackLayer.at(Side::Front, PropertySimple::R),
+                                 t_FrontLayer.at(Side::Back, PropertySimple::R));
 
         m_Tf = equivalentT(t_BackLayer.at(Side::Front, PropertySimple::T),
                            InterRefl1,
@@ -70,28 +76,24 @@ namespace MultiLayerOptics
     }
 
     SquareMatrix CBSDFDoubleLayer::equivalentT(const SquareMatrix & t_Tf2,
-                                               const SquareMatrix & t_InterRefl,
+                                               const LUFactorization & t_InterRefl,
                                                const std::vector<double> & t_Lambda,
                                                const SquareMatrix & t_Tf1)
     {
-        const auto TinterRefl = t_Tf2 * t_InterRefl;
         const auto lambdaTf1 = multiplyWithDiagonalMatrix(t_Lambda, t_Tf1);
-        return TinterRefl * lambdaTf1;
+        return t_Tf2 * t_InterRefl.solve(lambdaTf1);
     }
 
     SquareMatrix CBSDFDoubleLayer::equivalentR(const SquareMatrix & t_Rf1,
                                                const SquareMatrix & t_Tf1,
                                                const SquareMatrix & t_Tb1,
                                                const SquareMatrix & t_Rf2,
-                                               const SquareMatrix & t_InterRefl,
+                                               const LUFactorization & t_InterRefl,
                                                const std::vector<double> & t_Lambda)
     {
-        auto TinterRefl = t_Tb1 * t_InterRefl;
         const auto lambdaRf2 = multiplyWithDiagonalMatrix(t_Lambda, t_Rf2);
         const auto lambdaTf1 = multiplyWithDiagonalMatrix(t_Lambda, t_Tf1);
-        TinterRefl = TinterRefl * lambdaRf2;
-        TinterRefl = TinterRefl * lambdaTf1;
-        return t_Rf1 + TinterRefl;
+        return t_Rf1 + t_Tb1 * t_InterRefl.solve(lambdaRf2 * lambdaTf1);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,9 +246,10 @@ namespace MultiLayerOptics
             {
                 BSDFIntegrator & Layer1 = absLayers.Forward[i];
                 BSDFIntegrator & Layer2 = absLayers.Backward[i + 1];
-                const auto InterRefl2{interReflectance(m_Lambda,
-                                                       Layer2.at(Side::Front, PropertySimple::R),
-                                                       Layer1.at(Side::Back, PropertySimple::R))};
+                const auto InterRefl2{
+                  interReflectanceFactor(m_Lambda,
+                                         Layer2.at(Side::Front, PropertySimple::R),
+                                         Layer1.at(Side::Back, PropertySimple::R))};
                 const auto iMinus{
                   iminusCalc(InterRefl2, Layer2.getMatrix(Side::Back, PropertySimple::T))};
                 result.Iminus[EnergyFlow::Backward].push_back(iMinus);
@@ -268,9 +271,10 @@ namespace MultiLayerOptics
             {
                 BSDFIntegrator & Layer1 = absLayers.Forward[i - 1];
                 BSDFIntegrator & Layer2 = absLayers.Backward[i];
-                const auto InterRefl1{interReflectance(m_Lambda,
-                                                       Layer1.at(Side::Back, PropertySimple::R),
-                                                       Layer2.at(Side::Front, PropertySimple::R))};
+                const auto InterRefl1{
+                  interReflectanceFactor(m_Lambda,
+                                         Layer1.at(Side::Back, PropertySimple::R),
+                                         Layer2.at(Side::Front, PropertySimple::R))};
                 const auto iMinus{
                   iminusCalc(InterRefl1, Layer1.at(Side::Front, PropertySimple::T))};
                 result.Iminus[EnergyFlow::Forward].push_back(iMinus);
@@ -335,23 +339,19 @@ namespace MultiLayerOptics
         }
     }
 
-    SquareMatrix CEquivalentBSDFLayerSingleBand::iminusCalc(const SquareMatrix & t_InterRefl,
+    SquareMatrix CEquivalentBSDFLayerSingleBand::iminusCalc(const LUFactorization & t_InterRefl,
                                                             const SquareMatrix & t_T) const
     {
-        const auto part2 = multiplyWithDiagonalMatrix(m_Lambda, t_T);
-        auto part1 = t_InterRefl * part2;
-        return part1;
+        return t_InterRefl.solve(multiplyWithDiagonalMatrix(m_Lambda, t_T));
     }
 
-    SquareMatrix CEquivalentBSDFLayerSingleBand::iplusCalc(const SquareMatrix & t_InterRefl,
+    SquareMatrix CEquivalentBSDFLayerSingleBand::iplusCalc(const LUFactorization & t_InterRefl,
                                                            const SquareMatrix & t_R,
                                                            const SquareMatrix & t_T) const
     {
-        const auto part2 = multiplyWithDiagonalMatrix(m_Lambda, t_R);
-        const auto part3 = multiplyWithDiagonalMatrix(m_Lambda, t_T);
-        auto part1 = t_InterRefl * part2;
-        part1 = part1 * part3;
-        return part1;
+        const auto lambdaR = multiplyWithDiagonalMatrix(m_Lambda, t_R);
+        const auto lambdaT = multiplyWithDiagonalMatrix(m_Lambda, t_T);
+        return t_InterRefl.solve(lambdaR * lambdaT);
     }
 
 }   // namespace MultiLayerOptics
@@ -17,6 +17,13 @@ namespace MultiLayerOptics
                        const FenestrationCommon::SquareMatrix & t_Rb,
                        const FenestrationCommon::SquareMatrix & t_Rf);
 
+    //! Factorization of (I - Lambda * Rb * Lambda * Rf). Solving against it is equivalent to
+    //! multiplication with interReflectance, without forming the inverse.
+    FenestrationCommon::LUFactorization
+      interReflectanceFactor(const std::vector<double> & t_Lambda,
+                             const FenestrationCommon::SquareMatrix & t_Rb,
+                             const FenestrationCommon::SquareMatrix & t_Rf);
+
     // Class to calculate equivalent BSDF transmittance and reflectances. This will be used by
     // multilayer routines to calculate properties for any number of layers.
     class CBSDFDoubleLayer
@@ -30,7 +37,7 @@ namespace MultiLayerOptics
     private:
         static FenestrationCommon::SquareMatrix
           equivalentT(const FenestrationCommon::SquareMatrix & t_Tf2,
-                      const FenestrationCommon::SquareMatrix & t_InterRefl,
+                      const FenestrationCommon::LUFactorization & t_InterRefl,
                       const std::vector<double> & t_Lambda,
                       const FenestrationCommon::SquareMatrix & t_Tf1);
 
@@ -39,7 +46,7 @@ namespace MultiLayerOptics
                       const FenestrationCommon::SquareMatrix & t_Tf1,
                       const FenestrationCommon::SquareMatrix & t_Tb1,
                       const FenestrationCommon::SquareMatrix & t_Rf2,
-                      const FenestrationCommon::SquareMatrix & t_InterRefl,
+                      const FenestrationCommon::LUFactorization & t_InterRefl,
                       const std::vector<double> & t_Lambda);
 
         SingleLayerOptics::BSDFIntegrator m_Results;
@@ -87,11 +94,11 @@ namespace MultiLayerOptics
         void calcEquivalentProperties();
 
         [[nodiscard]] FenestrationCommon::SquareMatrix
-          iminusCalc(const FenestrationCommon::SquareMatrix & t_InterRefl,
+          iminusCalc(const FenestrationCommon::LUFactorization & t_InterRefl,
                      const FenestrationCommon::SquareMatrix & t_T) const;
 
         [[nodiscard]] FenestrationCommon::SquareMatrix
-          iplusCalc(const FenestrationCommon::SquareMatrix & t_InterRefl,
+          iplusCalc(const FenestrationCommon::LUFactorization & t_InterRefl,
                     const FenestrationCommon::SquareMatrix & t_R,
                     const FenestrationCommon::SquareMatrix & t_T) const;
 
@@ -2,6 +2,7 @@
 #include <numeric>
 #include <cassert>
 #include <utility>
+#include <algorithm>
 
 #include "MultiPaneBSDF.hpp"
 #include "EquivalentBSDFLayerSingleBand.hpp"
@@ -28,6 +29,12 @@ namespace SingleLayerOptics
 
 namespace MultiLayerOptics
 {
+    namespace
+    {
+        //! Number of wavelength ranges for which results are kept
+        const size_t RANGECACHESIZE = 8u;
+    }   // namespace
+
     CMultiPaneBSDF::CMultiPaneBSDF(const std::vector<std::shared_ptr<CBSDFLayer>> & t_Layer,
                                    const std::optional<std::vector<double>> & matrixWavelengths) :
         m_EquivalentLayer(t_Layer, matrixWavelengths),
@@ -100,81 +107,174 @@ namespace MultiLayerOptics
         if(!m_Calculated || minLambda != m_MinLambdaCalculated
            || maxLambda != m_MaxLambdaCalculated)
         {
-            m_IncomingSolar.clear();
+            if(m_Calculated)
+            {
+                cacheCurrentRange();
+            }
 
-            for(CSeries & aSpectra : m_IncomingSpectra)
+            if(!restoreFromCache(minLambda, maxLambda))
             {
-                CSeries iTotalSolar = aSpectra.integrate(
-                  m_CalculationProperties.m_IntegrationType, m_CalculationProperties.m_NormalizationCoefficient, m_SpectralIntegrationWavelengths);
-                m_IncomingSolar.push_back(iTotalSolar.sum(minLambda, maxLambda));
+                calculateRange(minLambda, maxLambda);
             }
 
-            // Produce local results matrices for each side and property
-            std::map<std::pair<Side, PropertySimple>, SquareMatrix> aResults;
+            m_MinLambdaCalculated = minLambda;
+            m_MaxLambdaCalculated = maxLambda;
+            m_Calculated = true;
+        }
+    }
 
-            for(Side aSide : FenestrationCommon::EnumSide())
-            {
-                CMatrixSeries aTotalA = m_EquivalentLayer.getTotalA(aSide);
-                // Calculates absorbed energy in every layer for every wavelength
-                if(m_SpectralIntegrationWavelengths.has_value())
-                {
-                    aTotalA.interpolate(m_SpectralIntegrationWavelengths.value());
-                }
-                aTotalA.mMult(m_IncomingSpectra);
-                aTotalA.integrate(
-                  m_CalculationProperties.m_IntegrationType, m_CalculationProperties.m_NormalizationCoefficient, m_SpectralIntegrationWavelengths);
-                // Calculates total absorptance for every layer over the given wavelength range
-                m_Abs[aSide] = aTotalA.getSums(minLambda, maxLambda, m_IncomingSolar);
-
-                CMatrixSeries jscTotal = m_EquivalentLayer.getTotalJSC(aSide);
-                jscTotal.integrate(
-                  m_CalculationProperties.m_IntegrationType, m_CalculationProperties.m_NormalizationCoefficient, m_SpectralIntegrationWavelengths);
-                auto jscSum{jscTotal.getSums(minLambda, maxLambda)};
-
-                std::vector<std::vector<double>> jscWithSolar;
-                for(size_t i = 0u; i < jscSum.size(); ++i)
-                {
-                    jscWithSolar.emplace_back();
-                    for(size_t j = 0u; j < jscSum[i].size(); ++j)
-                    {
-                        jscWithSolar[i].push_back(jscSum[i][j] * m_IncomingSolar[i]);
-                    }
-                }
+    void CMultiPaneBSDF::calculateSpectralSums()
+    {
+        m_IntegrationWavelengths = m_SpectralIntegrationWavelengths.has_value()
+                                     ? m_SpectralIntegrationWavelengths.value()
+                                     : m_EquivalentLayer.getCommonWavelengths();
 
-                // Default absorbed electricity is set to zero
-                m_AbsElectricity[aSide] = calcPVLayersElectricity(jscWithSolar, m_IncomingSolar);
+        std::vector<CSeries> aSpectra;
+        m_IntegrationSpectra.clear();
+        for(const CSeries & aSpectrum : m_IncomingSpectra)
+        {
+            aSpectra.push_back(aSpectrum.interpolate(m_IntegrationWavelengths));
+            m_IntegrationSpectra.push_back(aSpectra.back().getYArray());
+        }
 
-                for(PropertySimple aProprerty : FenestrationCommon::EnumPropertySimple())
-                {
-                    CMatrixSeries aTot = m_EquivalentLayer.getTotal(aSide, aProprerty);
-                    if(m_SpectralIntegrationWavelengths.has_value())
-                    {
-                        aTot.interpolate(m_SpectralIntegrationWavelengths.value());
-                    }
-                    aTot.mMult(m_IncomingSpectra);
-                    aTot.integrate(
-                      m_CalculationProperties.m_IntegrationType, m_CalculationProperties.m_NormalizationCoefficient, m_SpectralIntegrationWavelengths);
-                    aResults[{aSide, aProprerty}] =
-                      aTot.getSquaredMatrixSums(minLambda, maxLambda, m_IncomingSolar);
-                }
+        const auto integrationType{m_CalculationProperties.m_IntegrationType};
+        const auto normalizationCoefficient{m_CalculationProperties.m_NormalizationCoefficient};
 
-                // Update result matrices
-                m_Results.setMatrices(aResults.at({aSide, PropertySimple::T}),
-                                      aResults.at({aSide, PropertySimple::R}),
-                                      aSide);
-                m_Results.resetCalculatedResults();
+        for(Side aSide : FenestrationCommon::EnumSide())
+        {
+            CMatrixSeries aTotalA = m_EquivalentLayer.getTotalA(aSide);
+            aTotalA.interpolate(m_IntegrationWavelengths);
+            aTotalA.mMult(aSpectra);
+            aTotalA.integrate(integrationType, normalizationCoefficient, std::nullopt);
+            m_AbsSums[aSide] = aTotalA.prefixSums();
+
+            CMatrixSeries jscTotal = m_EquivalentLayer.getTotalJSC(aSide);
+            jscTotal.interpolate(m_IntegrationWavelengths);
+            jscTotal.integrate(integrationType, normalizationCoefficient, std::nullopt);
+            m_JscSums[aSide] = jscTotal.prefixSums();
+
+            for(PropertySimple aProprerty : FenestrationCommon::EnumPropertySimple())
+            {
+                CMatrixSeries aTot = m_EquivalentLayer.getTotal(aSide, aProprerty);
+                aTot.interpolate(m_IntegrationWavelengths);
+                aTot.mMult(aSpectra);
+                aTot.integrate(integrationType, normalizationCoefficient, std::nullopt);
+                m_TotalSums[{aSide, aProprerty}] = aTot.prefixSums();
             }
+        }
+
+        m_SpectralSumsCalculated = true;
+    }
 
-            // calculate hemispherical absorptances
-            for(const Side aSide : FenestrationCommon::EnumSide())
+    void CMultiPaneBSDF::calculateRange(const double minLambda, const double maxLambda)
+    {
+        if(!m_SpectralSumsCalculated)
+        {
+            calculateSpectralSums();
+        }
+
+        const FenestrationCommon::BandIntegral aIntegral(
+          m_IntegrationWavelengths,
+          m_CalculationProperties.m_IntegrationType,
+          m_CalculationProperties.m_NormalizationCoefficient,
+          minLambda,
+          maxLambda);
+
+        m_IncomingSolar.clear();
+        for(const auto & aSpectrum : m_IntegrationSpectra)
+        {
+            m_IncomingSolar.push_back(aIntegral.integrate(aSpectrum));
+        }
+
+        for(Side aSide : FenestrationCommon::EnumSide())
+        {
+            // Calculates total absorptance for every layer over the given wavelength range
+            m_Abs[aSide] = m_AbsSums.at(aSide).getSums(minLambda, maxLambda, m_IncomingSolar);
+
+            auto jscSum{m_JscSums.at(aSide).getSums(minLambda, maxLambda)};
+
+            std::vector<std::vector<double>> jscWithSolar;
+            for(size_t i = 0u; i < jscSum.size(); ++i)
             {
-                calcHemisphericalAbs(aSide);
+                jscWithSolar.emplace_back();
+                for(size_t j = 0u; j < jscSum[i].size(); ++j)
+                {
+                    jscWithSolar[i].push_back(jscSum[i][j] * m_IncomingSolar[i]);
+                }
             }
 
-            m_MinLambdaCalculated = minLambda;
-            m_MaxLambdaCalculated = maxLambda;
-            m_Calculated = true;
+            // Default absorbed electricity is set to zero
+            m_AbsElectricity[aSide] = calcPVLayersElectricity(jscWithSolar, m_IncomingSolar);
+
+            // Update result matrices
+            m_Results.setMatrices(
+              m_TotalSums.at({aSide, PropertySimple::T})
+                .getSquaredMatrixSums(minLambda, maxLambda, m_IncomingSolar),
+              m_TotalSums.at({aSide, PropertySimple::R})
+                .getSquaredMatrixSums(minLambda, maxLambda, m_IncomingSolar),
+              aSide);
+            m_Results.resetCalculatedResults();
+        }
+
+        // calculate hemispherical absorptances
+        for(const Side aSide : FenestrationCommon::EnumSide())
+        {
+            calcHemisphericalAbs(aSide);
+        }
+    }
+
+    void CMultiPaneBSDF::cacheCurrentRange()
+    {
+        // Results are stored again even if range is already in the cache because hemispherical
+        // results in m_Results are calculated on demand and might be available now.
+        RangeResults aResults{m_MinLambdaCalculated,
+                              m_MaxLambdaCalculated,
+                              m_IncomingSolar,
+                              m_Results,
+                              m_Abs,
+                              m_AbsElectricity,
+                              m_AbsHem,
+                              m_AbsHemElectricity};
+
+        auto it{std::find_if(
+          m_RangeCache.begin(), m_RangeCache.end(), [&](const RangeResults & cached) {
+              return cached.MinLambda == m_MinLambdaCalculated
+                     && cached.MaxLambda == m_MaxLambdaCalculated;
+          })};
+
+        if(it != m_RangeCache.end())
+        {
+            *it = std::move(aResults);
+            return;
         }
+
+        m_RangeCache.push_back(std::move(aResults));
+        if(m_RangeCache.size() > RANGECACHESIZE)
+        {
+            m_RangeCache.pop_front();
+        }
+    }
+
+    bool CMultiPaneBSDF::restoreFromCache(const double minLambda, const double maxLambda)
+    {
+        const auto it{std::find_if(
+          m_RangeCache.begin(), m_RangeCache.end(), [&](const RangeResults & cached) {
+              return cached.MinLambda == minLambda && cached.MaxLambda == maxLambda;
+          })};
+
+        if(it == m_RangeCache.end())
+        {
+            return false;
+        }
+
+        m_IncomingSolar = it->IncomingSolar;
+        m_Results = it->Results;
+        m_Abs = it->Abs;
+        m_AbsElectricity = it->AbsElectricity;
+        m_AbsHem = it->AbsHem;
+        m_AbsHemElectricity = it->AbsHemElectricity;
+
+        return true;
     }
 
     double CMultiPaneBSDF::integrateBSDFAbsorptance(const std::vector<double> & lambda,
@@ -437,6 +537,8 @@ namespace MultiLayerOptics
         m_SpectralIntegrationWavelengths = calcProperties.CommonWavelengths;
 
         m_Calculated = false;
+        m_SpectralSumsCalculated = false;
+        m_RangeCache.clear();
     }
 
     std::vector<double>
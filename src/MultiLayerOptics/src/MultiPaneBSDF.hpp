@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <deque>
 #include <WCECommon.hpp>
 #include <WCESingleLayerOptics.hpp>
 
@@ -193,6 +194,18 @@ namespace MultiLayerOptics
 
         void calculate(double minLambda, double maxLambda);
 
+        //! Spectrally weighted and integrated matrices that do not depend on the wavelength range
+        void calculateSpectralSums();
+
+        //! Results over the wavelength range calculated from the spectral sums
+        void calculateRange(double minLambda, double maxLambda);
+
+        //! Stores results of the currently calculated range into the cache
+        void cacheCurrentRange();
+
+        //! Restores results from the cache. Returns false if range is not in the cache.
+        bool restoreFromCache(double minLambda, double maxLambda);
+
         void calcHemisphericalAbs(FenestrationCommon::Side t_Side);
 
         [[nodiscard]] std::vector<double> getCommonWavelengthsFromLayers(
@@ -224,6 +237,34 @@ namespace MultiLayerOptics
         double m_MinLambdaCalculated;
         double m_MaxLambdaCalculated;
 
+        // Incoming spectra and integrated results stored as running sums over the wavelengths.
+        // Results over any range are differences of the running sums so changing the range does
+        // not require multiplication and integration of the matrices again.
+        bool m_SpectralSumsCalculated{false};
+        std::vector<double> m_IntegrationWavelengths;
+        std::vector<std::vector<double>> m_IntegrationSpectra;
+        std::map<FenestrationCommon::Side, FenestrationCommon::CMatrixSeriesPrefixSums> m_AbsSums;
+        std::map<FenestrationCommon::Side, FenestrationCommon::CMatrixSeriesPrefixSums> m_JscSums;
+        std::map<std::pair<FenestrationCommon::Side, FenestrationCommon::PropertySimple>,
+                 FenestrationCommon::CMatrixSeriesPrefixSums>
+          m_TotalSums;
+
+        // Results for previously calculated ranges. Cache is cleared whenever calculation
+        // properties change so the range is enough to identify the results.
+        struct RangeResults
+        {
+            double MinLambda;
+            double MaxLambda;
+            std::vector<double> IncomingSolar;
+            SingleLayerOptics::BSDFIntegrator Results;
+            std::map<FenestrationCommon::Side, std::vector<std::vector<double>>> Abs;
+            std::map<FenestrationCommon::Side, std::vector<std::vector<double>>> AbsElectricity;
+            std::map<FenestrationCommon::Side, std::vector<double>> AbsHem;
+            std::map<FenestrationCommon::Side, std::vector<double>> AbsHemElectricity;
+        };
+
+        std::deque<RangeResults> m_RangeCache;
+
         SingleLayerOptics::BSDFDirections m_BSDFDirections;
 
         // These are wavelength used only for the spectral integration separately from wavelengths in
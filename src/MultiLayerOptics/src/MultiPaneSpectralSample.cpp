@@ -29,7 +29,8 @@ namespace MultiLayerOptics
         {
             throw std::runtime_error("Index for glazing layer absorptance is out of range.");
         }
-        aEnergy = m_AbsorbedLayersSource.at(side)[Index - 1].sum(minLambda, maxLambda);
+        aEnergy = bandIntegral(minLambda, maxLambda)
+                    .integrate(m_AbsorbedLayersSource.at(side)[Index - 1].getYArray());
         return aEnergy;
     }
 
@@ -40,7 +41,8 @@ namespace MultiLayerOptics
     {
         calculateState(IntegrationType::Trapezoidal, 1);
         double absorbedEnergy = getLayerAbsorbedEnergy(minLambda, maxLambda, Index, side);
-        double incomingEnergy = m_IncomingSource.sum(minLambda, maxLambda);
+        double incomingEnergy =
+          bandIntegral(minLambda, maxLambda).integrate(m_IncomingSource.getYArray());
         return absorbedEnergy / incomingEnergy;
     }
 
@@ -62,14 +64,13 @@ namespace MultiLayerOptics
                     for(size_t i = 0; i < numOfLayers; ++i)
                     {
                         auto layerAbsorbed = aSample->getLayerAbsorptances(i + 1, side);
-                        integrateAndAppendAbsorptances(
-                          layerAbsorbed, side, integrator, normalizationCoefficient);
+                        appendAbsorbedEnergy(layerAbsorbed, side);
                     }
                 }
                 else
                 {
                     auto layerAbsorbed = m_SampleData->properties(Property::Abs, side);
-                    integrateAndAppendAbsorptances(layerAbsorbed, side, integrator, normalizationCoefficient);
+                    appendAbsorbedEnergy(layerAbsorbed, side);
                 }
             }
 
@@ -77,10 +78,7 @@ namespace MultiLayerOptics
         }
     }
 
-    void CMultiPaneSpectralSample::integrateAndAppendAbsorptances(const CSeries & t_Absorptances,
-                                                                  Side side,
-                                                                  FenestrationCommon::IntegrationType integrator,
-                                                                  double normalizationCoefficient)
+    void CMultiPaneSpectralSample::appendAbsorbedEnergy(const CSeries & t_Absorptances, Side side)
     {
         CSeries aAbs = t_Absorptances;
         if(m_WavelengthSet != WavelengthSet::Data)
@@ -88,7 +86,6 @@ namespace MultiLayerOptics
             aAbs = aAbs.interpolate(m_Wavelengths);
         }
         aAbs = aAbs * m_IncomingSource;
-        aAbs = aAbs.integrate(integrator, normalizationCoefficient);
         m_AbsorbedLayersSource.at(side).push_back(aAbs);
     }
 
@@ -39,9 +39,10 @@ namespace MultiLayerOptics
         void reset();
         void calculateProperties(FenestrationCommon::IntegrationType integrator,
                                  double m_NormalizationCoefficient);
-        void integrateAndAppendAbsorptances(const FenestrationCommon::CSeries & t_Absorptances, FenestrationCommon::Side side,FenestrationCommon::IntegrationType integrator,
-                                            double m_NormalizationCoefficient);
+        void appendAbsorbedEnergy(const FenestrationCommon::CSeries & t_Absorptances,
+                                  FenestrationCommon::Side side);
 
+        // Absorbed energy for every layer wavelength by wavelength
         std::map<FenestrationCommon::Side, std::vector<FenestrationCommon::CSeries>> m_AbsorbedLayersSource;
     };
 
@@ -142,15 +142,19 @@ namespace MultiLayerOptics
             }
         }
 
-        auto aMult = aProperties * solarRadiation;
-
-        const auto iIntegrated = aMult.integrate(t_IntegrationType, normalizationCoefficient);
-
-
-        const double totalProperty = iIntegrated.sum(minLambda, maxLambda);
-
-        double totalSolar = solarRadiation.integrate(t_IntegrationType, normalizationCoefficient)
-                              .sum(minLambda, maxLambda);
+        const double totalProperty = weightedBandIntegral(aProperties,
+                                                          solarRadiation,
+                                                          t_IntegrationType,
+                                                          normalizationCoefficient,
+                                                          minLambda,
+                                                          maxLambda);
+
+        const BandIntegral aSolarIntegral(solarRadiation.getXArray(),
+                                          t_IntegrationType,
+                                          normalizationCoefficient,
+                                          minLambda,
+                                          maxLambda);
+        const double totalSolar = aSolarIntegral.integrate(solarRadiation.getYArray());
 
         assert(totalSolar > 0);
 
@@ -322,14 +326,19 @@ namespace MultiLayerOptics
             }
         }
 
-        auto aMult = aProperties * m_ScaledSolarRadiation;
-
-        auto iIntegrated = aMult.integrate(t_IntegrationType, normalizationCoefficient);
+        const double totalProperty = weightedBandIntegral(aProperties,
+                                                          m_ScaledSolarRadiation,
+                                                          t_IntegrationType,
+                                                          normalizationCoefficient,
+                                                          minLambda,
+                                                          maxLambda);
 
-        double totalProperty = iIntegrated.sum(minLambda, maxLambda);
-        double totalSolar =
-          m_ScaledSolarRadiation.integrate(t_IntegrationType, normalizationCoefficient)
-            .sum(minLambda, maxLambda);
+        const BandIntegral aSolarIntegral(m_ScaledSolarRadiation.getXArray(),
+                                          t_IntegrationType,
+                                          normalizationCoefficient,
+                                          minLambda,
+                                          maxLambda);
+        const double totalSolar = aSolarIntegral.integrate(m_ScaledSolarRadiation.getYArray());
 
         assert(totalSolar > 0);
 
@@ -370,9 +379,12 @@ namespace MultiLayerOptics
     {
         if(std::dynamic_pointer_cast<PhotovoltaicSpecularLayer>(m_Layers[Index - 1]) != nullptr)
         {
-            const double totalEnergy =
-              m_ScaledSolarRadiation.integrate(t_IntegrationType, normalizationCoefficient)
-                .sum(minLambda, maxLambda);
+            const BandIntegral aSolarIntegral(m_ScaledSolarRadiation.getXArray(),
+                                              t_IntegrationType,
+                                              normalizationCoefficient,
+                                              minLambda,
+                                              maxLambda);
+            const double totalEnergy = aSolarIntegral.integrate(m_ScaledSolarRadiation.getYArray());
 
             CEquivalentLayerSingleComponentMWAngle aAngularProperties = getAngular(t_Angle);
             auto aLayer = std::dynamic_pointer_cast<PhotovoltaicSpecularLayer>(m_Layers[Index - 1]);
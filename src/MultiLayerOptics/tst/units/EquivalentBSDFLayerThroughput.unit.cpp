@@ -0,0 +1,86 @@
+#include <memory>
+#include <chrono>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "WCEMultiLayerOptics.hpp"
+#include "WCESingleLayerOptics.hpp"
+#include "WCECommon.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+using namespace MultiLayerOptics;
+
+// Equivalent BSDF layer calculations on the full Klems basis. Throughput benchmark is disabled
+// by default since it is only measuring time. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=EquivalentBSDFLayerThroughput.*
+class EquivalentBSDFLayerThroughput : public testing::Test
+{
+protected:
+    std::vector<std::shared_ptr<CBSDFLayer>> m_Layers;
+
+    void SetUp() override
+    {
+        const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Full);
+
+        const auto aMaterial =
+          Material::dualBandMaterial(0.1, 0.1, 0.7, 0.7, 0.2, 0.2, 0.6, 0.6);
+
+        const auto x = 0.01905;          // m
+        const auto y = 0.01905;          // m
+        const auto thickness = 0.005;    // m
+        const auto radius = 0.003175;    // m
+
+        m_Layers.push_back(
+          CBSDFLayerMaker::getCircularPerforatedLayer(aMaterial, aBSDF, x, y, thickness, radius));
+        m_Layers.push_back(CBSDFLayerMaker::getPerfectlyDiffuseLayer(aMaterial, aBSDF));
+    }
+
+    // Reference values are calculated with the row by row matrix multiplication
+    static void checkResults(CEquivalentBSDFLayer & aLayer)
+    {
+        const auto aTau{aLayer.getTotal(Side::Front, PropertySimple::T)};
+        const auto aRho{aLayer.getTotal(Side::Front, PropertySimple::R)};
+
+        // Solar band
+        EXPECT_NEAR(2.9555213077592884e-05, aTau[0][0][0].value(), 1e-12);
+        EXPECT_NEAR(2.9555213077592884e-05, aTau[40][0][0].value(), 1e-12);
+        EXPECT_NEAR(0.23749883764357024, aRho[0][0][0].value(), 1e-12);
+
+        // Visible band
+        EXPECT_NEAR(0.026463462305472665, aTau[0][0][1].value(), 1e-12);
+        EXPECT_NEAR(0.026463462305472665, aTau[40][0][1].value(), 1e-12);
+        EXPECT_NEAR(0.19672508729702073, aRho[0][0][1].value(), 1e-12);
+    }
+};
+
+TEST_F(EquivalentBSDFLayerThroughput, FullBasisResults)
+{
+    SCOPED_TRACE("Begin Test: Equivalent BSDF layer results (full basis).");
+
+    CEquivalentBSDFLayer aLayer(m_Layers, std::nullopt);
+    aLayer.calculate();
+
+    checkResults(aLayer);
+}
+
+TEST_F(EquivalentBSDFLayerThroughput, DISABLED_FullBasisCalculate)
+{
+    SCOPED_TRACE("Begin Test: Equivalent BSDF layer calculate throughput (full basis).");
+
+    CEquivalentBSDFLayer aLayer(m_Layers, std::nullopt);
+
+    const size_t numberOfRuns{10u};
+    const auto start{std::chrono::steady_clock::now()};
+    for(size_t i = 0u; i < numberOfRuns; ++i)
+    {
+        aLayer.calculate();
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    std::cout << "CEquivalentBSDFLayer::calculate (Full basis, "
+              << aLayer.getCommonWavelengths().size() << " wavelengths): "
+              << numberOfRuns / elapsed.count() << " calculations/s" << std::endl;
+
+    checkResults(aLayer);
+}
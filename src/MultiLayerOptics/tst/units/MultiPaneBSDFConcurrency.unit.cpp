@@ -0,0 +1,182 @@
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <tuple>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "WCESpectralAveraging.hpp"
+#include "WCEMultiLayerOptics.hpp"
+#include "WCESingleLayerOptics.hpp"
+#include "WCECommon.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+using namespace SpectralAveraging;
+using namespace MultiLayerOptics;
+
+// Stress test for independent multi-pane BSDF calculations that run on separate threads. Every
+// system creates its own materials and layers so calculations do not share any data and must give
+// the same results as the ones calculated serially.
+class MultiPaneBSDFConcurrency : public testing::Test
+{
+protected:
+    static CSeries solarRadiation()
+    {
+        return CSeries({{0.30, 0.0},
+                        {0.35, 212.0},
+                        {0.40, 556.0},
+                        {0.45, 956.6},
+                        {0.50, 1026.7},
+                        {0.60, 1088.8},
+                        {0.70, 1002.4},
+                        {0.80, 873.4},
+                        {1.00, 630.1},
+                        {1.50, 239.3},
+                        {2.00, 25.0},
+                        {2.50, 3.0}});
+    }
+
+    static std::shared_ptr<CSpectralSampleData> glassMeasurements(const double scale)
+    {
+        return CSpectralSampleData::create({{0.30, 0.002 * scale, 0.047, 0.048},
+                                            {0.35, 0.774 * scale, 0.078, 0.079},
+                                            {0.40, 0.893 * scale, 0.086, 0.086},
+                                            {0.45, 0.896 * scale, 0.085, 0.085},
+                                            {0.50, 0.905 * scale, 0.084, 0.084},
+                                            {0.60, 0.893 * scale, 0.081, 0.081},
+                                            {0.70, 0.854 * scale, 0.076, 0.077},
+                                            {0.80, 0.808 * scale, 0.072, 0.072},
+                                            {1.00, 0.762 * scale, 0.066, 0.067},
+                                            {1.50, 0.819 * scale, 0.069, 0.069},
+                                            {2.00, 0.839 * scale, 0.069, 0.069},
+                                            {2.50, 0.822 * scale, 0.068, 0.068}});
+    }
+
+    static std::shared_ptr<CSpectralSampleData> slatMeasurements()
+    {
+        return CSpectralSampleData::create({{0.30, 0.0, 0.0703, 0.0703},
+                                            {0.40, 0.0, 0.1550, 0.1550},
+                                            {0.50, 0.0, 0.5660, 0.5660},
+                                            {0.60, 0.0, 0.6440, 0.6440},
+                                            {0.80, 0.0, 0.6270, 0.6270},
+                                            {1.00, 0.0, 0.6050, 0.6050},
+                                            {1.50, 0.0, 0.5950, 0.5950},
+                                            {2.50, 0.0, 0.5550, 0.5550}});
+    }
+
+    //! Creates and calculates system made of glass and venetian blind. Returns front
+    //! transmittances and absorptances for a few directions.
+    static std::vector<double> calculateSystem(const size_t index)
+    {
+        const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Small);
+
+        const auto aGlass = Material::nBandMaterial(
+          glassMeasurements(1.0 - 0.02 * static_cast<double>(index)),
+          3.048e-3,
+          MaterialType::Monolithic);
+        const auto aGlassLayer = CBSDFLayerMaker::getSpecularLayer(aGlass, aBSDF);
+
+        const auto aSlat =
+          Material::nBandMaterial(slatMeasurements(), 1.5e-3, MaterialType::Monolithic);
+        const auto aVenetian =
+          CBSDFLayerMaker::getVenetianLayer(aSlat,
+                                            aBSDF,
+                                            0.016,
+                                            0.012,
+                                            5.0 * static_cast<double>(index),
+                                            0.0,
+                                            5,
+                                            DistributionMethod::UniformDiffuse,
+                                            true);
+
+        auto aSystem =
+          CMultiPaneBSDF::create({aGlassLayer, aVenetian}, aVenetian->getBandWavelengths());
+        aSystem->setCalculationProperties(
+          CalculationProperties{solarRadiation(), solarRadiation().getXArray()});
+
+        const double minLambda{0.3};
+        const double maxLambda{2.5};
+
+        std::vector<double> results;
+        for(const auto theta : {0.0, 30.0, 60.0})
+        {
+            results.push_back(
+              aSystem->DirHem(minLambda, maxLambda, Side::Front, PropertySimple::T, theta, 0));
+            results.push_back(aSystem->Abs(minLambda, maxLambda, Side::Front, 1, theta, 0));
+            results.push_back(aSystem->Abs(minLambda, maxLambda, Side::Front, 2, theta, 0));
+        }
+        results.push_back(aSystem->DiffDiff(minLambda, maxLambda, Side::Front, PropertySimple::T));
+
+        return results;
+    }
+
+    static std::vector<std::vector<double>> calculateSerial(const size_t numberOfSystems)
+    {
+        std::vector<std::vector<double>> results(numberOfSystems);
+        for(size_t i = 0u; i < numberOfSystems; ++i)
+        {
+            results[i] = calculateSystem(i);
+        }
+        return results;
+    }
+
+    static std::vector<std::vector<double>> calculateConcurrent(const size_t numberOfSystems)
+    {
+        std::vector<std::vector<double>> results(numberOfSystems);
+        std::vector<std::thread> workers;
+        for(size_t i = 0u; i < numberOfSystems; ++i)
+        {
+            workers.emplace_back([&results, i]() { results[i] = calculateSystem(i); });
+        }
+        for(auto & worker : workers)
+        {
+            worker.join();
+        }
+        return results;
+    }
+};
+
+TEST_F(MultiPaneBSDFConcurrency, IndependentSystems)
+{
+    SCOPED_TRACE("Begin Test: Independent multi-pane BSDF systems calculated concurrently.");
+
+    const size_t numberOfSystems{4u};
+
+    const auto serial{calculateSerial(numberOfSystems)};
+    const auto concurrent{calculateConcurrent(numberOfSystems)};
+
+    for(size_t i = 0u; i < numberOfSystems; ++i)
+    {
+        ASSERT_EQ(serial[i].size(), concurrent[i].size());
+        for(size_t j = 0u; j < serial[i].size(); ++j)
+        {
+            EXPECT_NEAR(serial[i][j], concurrent[i][j], 1e-12);
+        }
+    }
+}
+
+// Benchmark that only measures scaling of concurrent calculations. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=MultiPaneBSDFConcurrency.*
+TEST_F(MultiPaneBSDFConcurrency, DISABLED_Scaling)
+{
+    SCOPED_TRACE("Begin Test: Scaling of independent multi-pane BSDF systems.");
+
+    const size_t numberOfSystems{std::max(2u, std::thread::hardware_concurrency())};
+
+    const auto serialStart{std::chrono::steady_clock::now()};
+    std::ignore = calculateSerial(numberOfSystems);
+    const std::chrono::duration<double> serialTime{std::chrono::steady_clock::now()
+                                                   - serialStart};
+
+    const auto concurrentStart{std::chrono::steady_clock::now()};
+    std::ignore = calculateConcurrent(numberOfSystems);
+    const std::chrono::duration<double> concurrentTime{std::chrono::steady_clock::now()
+                                                       - concurrentStart};
+
+    std::cout << numberOfSystems << " independent CMultiPaneBSDF systems: serial "
+              << serialTime.count() << " s, concurrent " << concurrentTime.count()
+              << " s, scaling " << serialTime.count() / concurrentTime.count() << "x"
+              << std::endl;
+}
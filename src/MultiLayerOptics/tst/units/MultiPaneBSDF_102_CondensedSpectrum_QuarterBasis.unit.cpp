@@ -153,9 +153,7 @@ protected:
 
         m_Layer = CMultiPaneBSDF::create({Layer_102}, condensed);
 
-        const CalculationProperties input{loadSolarRadiationFile(),
-                                          loadSolarRadiationFile().getXArray()};
-        m_Layer->setCalculationProperties(input);
+        resetCalculationProperties();
     }
 
 public:
@@ -163,6 +161,13 @@ public:
     {
         return *m_Layer;
     }
+
+    void resetCalculationProperties()
+    {
+        const SingleLayerOptics::CalculationProperties input{
+          loadSolarRadiationFile(), loadSolarRadiationFile().getXArray()};
+        m_Layer->setCalculationProperties(input);
+    }
 };
 
 TEST_F(MultiPaneBSDF_102_CondensedSpectrum_QuarterBasis, TestSpecular1)
@@ -219,3 +224,42 @@ TEST_F(MultiPaneBSDF_102_CondensedSpectrum_QuarterBasis, TestSpecular1)
     abs1 = aLayer.Abs(minLambda, maxLambda, Side::Front, 1, theta, phi);
     EXPECT_NEAR(0.101126, abs1, 1e-6);
 }
+
+TEST_F(MultiPaneBSDF_102_CondensedSpectrum_QuarterBasis, ChangingWavelengthRange)
+{
+    using FenestrationCommon::Side;
+    using FenestrationCommon::PropertySimple;
+
+    constexpr double solarMin = 0.3;
+    constexpr double solarMax = 2.5;
+    constexpr double visibleMin = 0.38;
+    constexpr double visibleMax = 0.78;
+
+    constexpr double theta = 45;
+    constexpr double phi = 78;
+
+    CMultiPaneBSDF & aLayer = getLayer();
+
+    const double tauSolar =
+      aLayer.DirHem(solarMin, solarMax, Side::Front, PropertySimple::T, theta, phi);
+    const double absSolar = aLayer.AbsDiff(solarMin, solarMax, Side::Front, 1);
+
+    const double tauVisible =
+      aLayer.DirHem(visibleMin, visibleMax, Side::Front, PropertySimple::T, theta, phi);
+    const double absVisible = aLayer.AbsDiff(visibleMin, visibleMax, Side::Front, 1);
+
+    // Solar results are restored from the cache
+    EXPECT_EQ(tauSolar,
+              aLayer.DirHem(solarMin, solarMax, Side::Front, PropertySimple::T, theta, phi));
+    EXPECT_EQ(absSolar, aLayer.AbsDiff(solarMin, solarMax, Side::Front, 1));
+
+    EXPECT_NEAR(0.819753, tauSolar, 1e-6);
+    EXPECT_NEAR(0.104110, absSolar, 1e-6);
+
+    // Visible results calculated from running sums must be the same as ones calculated first
+    resetCalculationProperties();
+    EXPECT_NEAR(tauVisible,
+                aLayer.DirHem(visibleMin, visibleMax, Side::Front, PropertySimple::T, theta, phi),
+                1e-12);
+    EXPECT_NEAR(absVisible, aLayer.AbsDiff(visibleMin, visibleMax, Side::Front, 1), 1e-12);
+}
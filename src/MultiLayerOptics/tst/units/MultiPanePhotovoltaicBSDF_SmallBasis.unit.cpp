@@ -1,4 +1,6 @@
 #include <memory>
+#include <chrono>
+#include <iostream>
 #include <gtest/gtest.h>
 
 #include "WCESpectralAveraging.hpp"
@@ -19,6 +21,7 @@ class MultiPanePhotovoltaicBSDF_SmallBasis : public testing::Test
 private:
     std::unique_ptr<CMultiPaneBSDF> m_Layer;
 
+protected:
     static CSeries loadSolarRadiationFile()
     {
         // Full ASTM E891-87 Table 1 (Solar radiation)
@@ -1797,8 +1800,7 @@ private:
                 {39.99999999, 0.604477298, 0.718541498}}};
     }
 
-protected:
-    virtual void SetUp()
+    [[nodiscard]] std::shared_ptr<CBSDFLayer> createLayer(const BSDFBasis t_Basis) const
     {
         auto pvSample =
           std::make_shared<PhotovoltaicSampleData>(*loadSampleData_1(), eqeFront(), eqeBack());
@@ -1807,10 +1809,13 @@ protected:
         const auto aMaterial_1 =
           Material::nBandPhotovoltaicMaterial(pvSample, thickness, MaterialType::Monolithic);
 
-        const auto aBSDF = BSDFHemisphere::create(BSDFBasis::Small);
-        auto Layer_1 = CBSDFLayerMaker::getPhotovoltaicSpecularLayer(aMaterial_1, aBSDF, table());
+        const auto aBSDF = BSDFHemisphere::create(t_Basis);
+        return CBSDFLayerMaker::getPhotovoltaicSpecularLayer(aMaterial_1, aBSDF, table());
+    }
 
-        m_Layer = CMultiPaneBSDF::create({Layer_1});
+    virtual void SetUp()
+    {
+        m_Layer = CMultiPaneBSDF::create({createLayer(BSDFBasis::Small)});
 
         const CalculationProperties input{loadSolarRadiationFile(),
                                           loadSolarRadiationFile().getXArray()};
@@ -1850,3 +1855,34 @@ TEST_F(MultiPanePhotovoltaicBSDF_SmallBasis, TestSpecular1)
       aLayer.AbsElectricity(minLambda, maxLambda, Side::Back, 1, theta, phi)};
     EXPECT_NEAR(0.045253845152651906, absElectricBack1, 1e-6);
 }
+
+TEST_F(MultiPanePhotovoltaicBSDF_SmallBasis, DISABLED_FullBasisThroughput)
+{
+    SCOPED_TRACE("Begin Test: Photovoltaic multi-pane BSDF throughput (full basis).");
+
+    // Benchmark is slow and it is disabled by default. Run it with
+    // --gtest_also_run_disabled_tests --gtest_filter=MultiPanePhotovoltaicBSDF_SmallBasis.*
+    constexpr double minLambda = 0.3;
+    constexpr double maxLambda = 2.5;
+
+    const auto start{std::chrono::steady_clock::now()};
+    const auto aLayer{CMultiPaneBSDF::create({createLayer(BSDFBasis::Full)})};
+    const CalculationProperties input{loadSolarRadiationFile(),
+                                      loadSolarRadiationFile().getXArray()};
+    aLayer->setCalculationProperties(input);
+
+    const auto theta{0.0};
+    const auto phi{0};
+
+    const double abs1{aLayer->Abs(minLambda, maxLambda, Side::Front, 1, theta, phi)};
+    const double absElectricFront1{
+      aLayer->AbsElectricity(minLambda, maxLambda, Side::Front, 1, theta, phi)};
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    std::cout << "Photovoltaic CMultiPaneBSDF (Full basis): " << elapsed.count() << " s"
+              << std::endl;
+
+    // Specular layer at normal incidence gives the same results as in the small basis
+    EXPECT_NEAR(0.77708465456652798, abs1, 1e-6);
+    EXPECT_NEAR(0.10624255315172096, absElectricFront1, 1e-6);
+}
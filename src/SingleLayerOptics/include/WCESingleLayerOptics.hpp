@@ -4,6 +4,7 @@
 #include "../src/BaseCell.hpp"
 #include "../src/BeamDirection.hpp"
 #include "../src/BSDFDirections.hpp"
+#include "../src/BSDFFactoredResults.hpp"
 #include "../src/BSDFIntegrator.hpp"
 #include "../src/BSDFLayer.hpp"
 #include "../src/BSDFLayerMaker.hpp"
@@ -19,6 +20,7 @@
 #include "../src/Material.hpp"
 #include "../src/OpticalSurface.hpp"
 #include "../src/FlatCellDescription.hpp"
+#include "../src/PerfectDiffuseCell.hpp"
 #include "../src/PerforatedCell.hpp"
 #include "../src/PerforatedCellDescription.hpp"
 #include "../src/ScatteringLayer.hpp"
@@ -12,6 +12,44 @@ using namespace FenestrationCommon;
 
 namespace SingleLayerOptics
 {
+    namespace
+    {
+        // Limits are increasing and neighbouring limits are touching each other. Returns first
+        // index in the range [begin, end) with limits that contain the angle.
+        std::optional<size_t> firstInLimits(const std::vector<double> & t_Low,
+                                            const std::vector<double> & t_High,
+                                            const size_t t_Begin,
+                                            const size_t t_End,
+                                            const double t_Angle)
+        {
+            const auto it{std::partition_point(
+              std::next(t_High.begin(), t_Begin),
+              std::next(t_High.begin(), t_End),
+              [t_Angle](const double high) { return high < t_Angle; })};
+            const auto index{static_cast<size_t>(std::distance(t_High.begin(), it))};
+            if(index < t_End && t_Low[index] <= t_Angle)
+            {
+                return index;
+            }
+            return std::nullopt;
+        }
+
+        // Same as AngleLimits::isInLimits, angles that are more than full circle above the lower
+        // limit are checked one circle lower. Since lower limits are increasing that is the case
+        // for the first part of the range.
+        size_t wrappedRangeEnd(const std::vector<double> & t_Low,
+                               const size_t t_Begin,
+                               const size_t t_End,
+                               const double t_Angle)
+        {
+            const auto it{std::partition_point(
+              std::next(t_Low.begin(), t_Begin),
+              std::next(t_Low.begin(), t_End),
+              [t_Angle](const double low) { return (low + 360) < t_Angle; })};
+            return static_cast<size_t>(std::distance(t_Low.begin(), it));
+        }
+    }   // namespace
+
     /////////////////////////////////////////////////////////////////
     ///  BSDFDefinition
     /////////////////////////////////////////////////////////////////
@@ -35,14 +73,54 @@ namespace SingleLayerOptics
     ///  BSDFDirections
     /////////////////////////////////////////////////////////////////
 
+    BSDFDirections::BSDFDirections()
+    {
+        static const auto emptyGeometry{std::make_shared<const Geometry>()};
+        m_Geometry = emptyGeometry;
+    }
+
     BSDFDirections::BSDFDirections(const std::vector<BSDFDefinition> & t_Definitions,
                                    const BSDFDirection t_Side) :
-        m_Patches(createBSDFPatches(
-          t_Side, getThetaAngles(t_Definitions), getNumberOfPhiAngles(t_Definitions))),
-        m_LambdaVector(getLambdaVector(m_Patches)),
-        m_LambdaMatrix(setLambdaMatrix(m_LambdaVector))
+        m_Geometry(createGeometry(t_Definitions, t_Side))
     {}
 
+    std::shared_ptr<const BSDFDirections::Geometry>
+      BSDFDirections::createGeometry(const std::vector<BSDFDefinition> & t_Definitions,
+                                     const BSDFDirection t_Side)
+    {
+        auto geometry{std::make_shared<Geometry>()};
+        geometry->patches = createBSDFPatches(
+          t_Side, getThetaAngles(t_Definitions), getNumberOfPhiAngles(t_Definitions));
+        geometry->lambdaVector = getLambdaVector(geometry->patches);
+        geometry->lambdaMatrix = setLambdaMatrix(geometry->lambdaVector);
+        geometry->centerPoints.reserve(geometry->patches.size());
+        for(const auto & patch : geometry->patches)
+        {
+            geometry->centerPoints.push_back(patch.centerPoint());
+        }
+        createPatchIndex(*geometry);
+        return geometry;
+    }
+
+    void BSDFDirections::createPatchIndex(Geometry & t_Geometry)
+    {
+        const auto & patches{t_Geometry.patches};
+        for(size_t i = 0u; i < patches.size(); ++i)
+        {
+            const auto & theta{patches[i].theta()};
+            if(t_Geometry.ringStart.empty() || theta.low() != t_Geometry.ringThetaLow.back()
+               || theta.high() != t_Geometry.ringThetaHigh.back())
+            {
+                t_Geometry.ringStart.push_back(i);
+                t_Geometry.ringThetaLow.push_back(theta.low());
+                t_Geometry.ringThetaHigh.push_back(theta.high());
+            }
+            t_Geometry.phiLow.push_back(patches[i].phi().low());
+            t_Geometry.phiHigh.push_back(patches[i].phi().high());
+        }
+        t_Geometry.ringStart.push_back(patches.size());
+    }
+
     std::vector<size_t>
       BSDFDirections::getNumberOfPhiAngles(const std::vector<BSDFDefinition> & t_Definitions)
     {
@@ -106,47 +184,110 @@ namespace SingleLayerOptics
 
     size_t BSDFDirections::size() const
     {
-        return m_Patches.size();
+        return m_Geometry->patches.size();
     }
 
     const CBSDFPatch & BSDFDirections::operator[](size_t Index) const
     {
-        return m_Patches[Index];
+        return m_Geometry->patches[Index];
     }
 
-    std::vector<CBSDFPatch>::iterator BSDFDirections::begin()
+    std::vector<CBSDFPatch>::const_iterator BSDFDirections::begin() const
     {
-        return m_Patches.begin();
+        return m_Geometry->patches.begin();
     }
 
-    std::vector<CBSDFPatch>::iterator BSDFDirections::end()
+    std::vector<CBSDFPatch>::const_iterator BSDFDirections::end() const
     {
-        return m_Patches.end();
+        return m_Geometry->patches.end();
     }
 
-    std::vector<double> BSDFDirections::lambdaVector() const
+    const std::vector<double> & BSDFDirections::lambdaVector() const
     {
-        return m_LambdaVector;
+        return m_Geometry->lambdaVector;
     }
 
     const SquareMatrix & BSDFDirections::lambdaMatrix() const
     {
-        return m_LambdaMatrix;
+        return m_Geometry->lambdaMatrix;
+    }
+
+    const std::vector<CBeamDirection> & BSDFDirections::centerPoints() const
+    {
+        return m_Geometry->centerPoints;
     }
 
     size_t BSDFDirections::getNearestBeamIndex(const double t_Theta, const double t_Phi) const
     {
-        auto it = std::find_if(m_Patches.begin(), m_Patches.end(), [&](const CBSDFPatch & a) {
-            return a.isInPatch(t_Theta, t_Phi);
-        });
+        // Patch is found in the same order as it would be found by checking all patches one by
+        // one. Angle that is on the boundary belongs to the patch with lower index.
+        const auto & ringThetaLow{m_Geometry->ringThetaLow};
+        const auto numberOfRings{ringThetaLow.size()};
+        const auto wrappedEnd{wrappedRangeEnd(ringThetaLow, 0u, numberOfRings, t_Theta)};
+        auto index{nearestBeamIndexInRings(0u, wrappedEnd, t_Theta - 360, t_Phi)};
+        if(!index.has_value())
+        {
+            index = nearestBeamIndexInRings(wrappedEnd, numberOfRings, t_Theta, t_Phi);
+        }
 
-        if(it == m_Patches.end())
+        if(!index.has_value())
         {
             throw std::runtime_error("Could not find nearest beam index");
         }
 
-        size_t index = size_t(std::distance(m_Patches.begin(), it));
-        return index;
+        return index.value();
+    }
+
+    std::optional<size_t> BSDFDirections::nearestBeamIndexInRings(const size_t t_Begin,
+                                                                  const size_t t_End,
+                                                                  const double t_Theta,
+                                                                  const double t_Phi) const
+    {
+        const auto & geometry{*m_Geometry};
+        const auto first{
+          firstInLimits(geometry.ringThetaLow, geometry.ringThetaHigh, t_Begin, t_End, t_Theta)};
+        if(!first.has_value())
+        {
+            return std::nullopt;
+        }
+
+        // Ring limits are touching each other so angle on the boundary is in two rings
+        for(auto ring = first.value(); ring < t_End && geometry.ringThetaLow[ring] <= t_Theta;
+            ++ring)
+        {
+            const auto ringBegin{geometry.ringStart[ring]};
+            const auto ringEnd{geometry.ringStart[ring + 1]};
+            const auto wrappedEnd{wrappedRangeEnd(geometry.phiLow, ringBegin, ringEnd, t_Phi)};
+            auto index{firstInLimits(
+              geometry.phiLow, geometry.phiHigh, ringBegin, wrappedEnd, t_Phi - 360)};
+            if(!index.has_value())
+            {
+                index = firstInLimits(geometry.phiLow, geometry.phiHigh, wrappedEnd, ringEnd, t_Phi);
+            }
+            if(index.has_value())
+            {
+                return index;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<size_t>
+      BSDFDirections::getNearestBeamIndices(const std::vector<double> & t_Theta,
+                                            const std::vector<double> & t_Phi) const
+    {
+        if(t_Theta.size() != t_Phi.size())
+        {
+            throw std::runtime_error("Number of theta and phi angles must be the same.");
+        }
+
+        std::vector<size_t> result(t_Theta.size());
+        for(size_t i = 0u; i < t_Theta.size(); ++i)
+        {
+            result[i] = getNearestBeamIndex(t_Theta[i], t_Phi[i]);
+        }
+        return result;
     }
 
     AngleLimits
@@ -155,7 +296,7 @@ namespace SingleLayerOptics
         return patchIndex == 1 ? AngleLimits(upperAngle) : AngleLimits(lowerAngle, upperAngle);
     }
 
-    std::vector<double> BSDFDirections::getLambdaVector(std::vector<CBSDFPatch> patches)
+    std::vector<double> BSDFDirections::getLambdaVector(const std::vector<CBSDFPatch> & patches)
     {
         std::vector<double> lambda(patches.size());
         std::transform(std::begin(patches),
@@ -176,9 +317,10 @@ namespace SingleLayerOptics
     std::vector<double> BSDFDirections::profileAngles() const
     {
         std::vector<double> angles;
-        for(const auto & patch : m_Patches)
+        angles.reserve(size());
+        for(const auto & centerPoint : m_Geometry->centerPoints)
         {
-            angles.push_back(patch.centerPoint().profileAngle());
+            angles.push_back(centerPoint.profileAngle());
         }
         return angles;
     }
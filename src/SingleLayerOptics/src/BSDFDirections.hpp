@@ -3,6 +3,7 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <optional>
 
 #include "WCECommon.hpp"
 #include "BSDFPatch.hpp"
@@ -42,34 +43,70 @@ namespace SingleLayerOptics
         return EnumBSDFDirection::Iterator(static_cast<int>(BSDFDirection::Outgoing) + 1);
     }
 
+    // Directions do not change once they are created. Copies of directions are sharing the same
+    // patches, lambdas and center points so directions can be passed around by value without
+    // allocating new memory.
     class BSDFDirections
     {
     public:
-        BSDFDirections() = default;
+        BSDFDirections();
         BSDFDirections(const std::vector<BSDFDefinition> & t_Definitions, BSDFDirection t_Side);
         [[nodiscard]] size_t size() const;
         const CBSDFPatch & operator[](size_t Index) const;
-        std::vector<CBSDFPatch>::iterator begin();
-        std::vector<CBSDFPatch>::iterator end();
+        [[nodiscard]] std::vector<CBSDFPatch>::const_iterator begin() const;
+        [[nodiscard]] std::vector<CBSDFPatch>::const_iterator end() const;
 
-        [[nodiscard]] std::vector<double> lambdaVector() const;
+        [[nodiscard]] const std::vector<double> & lambdaVector() const;
         [[nodiscard]] std::vector<double> profileAngles() const;
         [[nodiscard]] const FenestrationCommon::SquareMatrix & lambdaMatrix() const;
 
+        // Center points of the patches
+        [[nodiscard]] const std::vector<CBeamDirection> & centerPoints() const;
+
         // returns index of element that is closest to given Theta and Phi angles
         [[nodiscard]] size_t getNearestBeamIndex(double t_Theta, double t_Phi) const;
 
+        // returns indices of elements that are closest to given pairs of Theta and Phi angles
+        [[nodiscard]] std::vector<size_t>
+          getNearestBeamIndices(const std::vector<double> & t_Theta,
+                                const std::vector<double> & t_Phi) const;
+
     private:
-        std::vector<CBSDFPatch> m_Patches;
-        std::vector<double> m_LambdaVector;
-        FenestrationCommon::SquareMatrix m_LambdaMatrix;
+        struct Geometry
+        {
+            std::vector<CBSDFPatch> patches;
+            std::vector<double> lambdaVector;
+            FenestrationCommon::SquareMatrix lambdaMatrix;
+            std::vector<CBeamDirection> centerPoints;
+
+            // Patches are ordered by theta rings and by phi inside of each ring. Limits are
+            // stored separately so that the patch can be found with binary search over rings and
+            // then over phi limits of the ring. Ring i contains patches from ringStart[i] to
+            // ringStart[i + 1].
+            std::vector<size_t> ringStart;
+            std::vector<double> ringThetaLow;
+            std::vector<double> ringThetaHigh;
+            std::vector<double> phiLow;
+            std::vector<double> phiHigh;
+        };
+
+        std::shared_ptr<const Geometry> m_Geometry;
+
+        static std::shared_ptr<const Geometry>
+          createGeometry(const std::vector<BSDFDefinition> & t_Definitions, BSDFDirection t_Side);
+        static void createPatchIndex(Geometry & t_Geometry);
+        [[nodiscard]] std::optional<size_t> nearestBeamIndexInRings(size_t t_Begin,
+                                                                    size_t t_End,
+                                                                    double t_Theta,
+                                                                    double t_Phi) const;
 
         //! Function that will create angle limits based on patch index.
-        AngleLimits createAngleLimits(double lowerAngle, double upperAngle, size_t patchIndex);
+        static AngleLimits
+          createAngleLimits(double lowerAngle, double upperAngle, size_t patchIndex);
         static double correctPhiForOutgoingDireciton(const BSDFDirection & t_Side,
                                             const size_t nPhis,
                                             double currentPhi) ;
-        std::vector<CBSDFPatch> createBSDFPatches(const BSDFDirection & t_Side,
+        static std::vector<CBSDFPatch> createBSDFPatches(const BSDFDirection & t_Side,
                                const std::vector<double> & thetaAngles,
                                const std::vector<size_t> & numPhiAngles);
         static std::vector<double>
@@ -77,7 +114,7 @@ namespace SingleLayerOptics
         static std::vector<size_t>
           getNumberOfPhiAngles(const std::vector<BSDFDefinition> & t_Definitions) ;
 
-        static std::vector<double> getLambdaVector(std::vector<CBSDFPatch> patches);
+        static std::vector<double> getLambdaVector(const std::vector<CBSDFPatch> & patches);
         static FenestrationCommon::SquareMatrix setLambdaMatrix(const std::vector<double> & lambdas);
     };
 
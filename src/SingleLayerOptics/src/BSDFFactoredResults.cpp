@@ -0,0 +1,99 @@
+#include <stdexcept>
+
+#include "BSDFFactoredResults.hpp"
+#include "WCECommon.hpp"
+
+using namespace FenestrationCommon;
+
+namespace SingleLayerOptics
+{
+    BSDFFactoredResults::BSDFFactoredResults(const BSDFDirections & t_Directions,
+                                             const size_t t_NumberOfWavelengths) :
+        m_Directions(t_Directions),
+        m_NumberOfWavelengths(t_NumberOfWavelengths)
+    {
+        for(auto aSide : EnumSide())
+        {
+            for(auto aProperty : EnumPropertySimple())
+            {
+                auto & aFactors{m_Factors[{aSide, aProperty}]};
+                aFactors.direct.resize(m_Directions.size(), 0);
+                aFactors.materialFraction.resize(m_Directions.size(), 0);
+                aFactors.materialProperties.resize(m_NumberOfWavelengths, 0);
+            }
+        }
+    }
+
+    void BSDFFactoredResults::setDirect(const Side t_Side,
+                                        const PropertySimple t_Property,
+                                        std::vector<double> t_Values)
+    {
+        if(t_Values.size() != m_Directions.size())
+        {
+            throw std::runtime_error(
+              "Number of direct values must match number of BSDF directions.");
+        }
+        factors(t_Side, t_Property).direct = std::move(t_Values);
+    }
+
+    void BSDFFactoredResults::setDiffuse(const Side t_Side,
+                                         const PropertySimple t_Property,
+                                         std::vector<double> t_MaterialFraction,
+                                         std::vector<double> t_MaterialProperties)
+    {
+        if(t_MaterialFraction.size() != m_Directions.size())
+        {
+            throw std::runtime_error(
+              "Number of material fractions must match number of BSDF directions.");
+        }
+        if(t_MaterialProperties.size() != m_NumberOfWavelengths)
+        {
+            throw std::runtime_error(
+              "Number of material properties must match number of wavelengths.");
+        }
+        auto & aFactors{factors(t_Side, t_Property)};
+        aFactors.materialFraction = std::move(t_MaterialFraction);
+        aFactors.materialProperties = std::move(t_MaterialProperties);
+    }
+
+    size_t BSDFFactoredResults::numberOfWavelengths() const
+    {
+        return m_NumberOfWavelengths;
+    }
+
+    BSDFIntegrator BSDFFactoredResults::at(const size_t wavelengthIndex) const
+    {
+        if(wavelengthIndex >= m_NumberOfWavelengths)
+        {
+            throw std::runtime_error("Wavelength index is out of range.");
+        }
+
+        BSDFIntegrator results{m_Directions};
+        const auto size{m_Directions.size()};
+        for(const auto & [key, aFactors] : m_Factors)
+        {
+            auto & aMatrix{results.getMatrix(key.first, key.second)};
+            const auto materialProperty{aFactors.materialProperties[wavelengthIndex]};
+            for(size_t j = 0u; j < size; ++j)
+            {
+                using ConstantsData::WCE_PI;
+
+                // Same operation order as in layer calculations so results are identical
+                const auto diffuse{aFactors.materialFraction[j] * materialProperty / WCE_PI};
+                for(size_t i = 0u; i < size; ++i)
+                {
+                    aMatrix(i, j) = i == j ? aFactors.direct[i] + diffuse : diffuse;
+                }
+            }
+        }
+
+        return results;
+    }
+
+    BSDFFactoredResults::Factors & BSDFFactoredResults::factors(const Side t_Side,
+                                                                const PropertySimple t_Property)
+    {
+        return m_Factors.at({t_Side, t_Property});
+    }
+
+}   // namespace SingleLayerOptics
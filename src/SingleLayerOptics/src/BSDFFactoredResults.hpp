@@ -0,0 +1,64 @@
+#ifndef BSDFFACTOREDRESULTS_H
+#define BSDFFACTOREDRESULTS_H
+
+#include <map>
+#include <vector>
+
+#include "BSDFDirections.hpp"
+#include "BSDFIntegrator.hpp"
+
+namespace FenestrationCommon
+{
+    enum class Side;
+    enum class PropertySimple;
+
+}   // namespace FenestrationCommon
+
+namespace SingleLayerOptics
+{
+    // BSDF results of the layer whose direct part depends only on geometry and whose diffuse part
+    // is geometry multiplied by the material property at given wavelength and distributed
+    // uniformly over the hemisphere. Cell geometry is evaluated once for all wavelengths and full
+    // BSDF matrices of the wavelength are created from it when requested.
+    class BSDFFactoredResults
+    {
+    public:
+        BSDFFactoredResults(const BSDFDirections & t_Directions, size_t t_NumberOfWavelengths);
+
+        // Direct part of the beam for each incoming direction (matrix diagonal).
+        void setDirect(FenestrationCommon::Side t_Side,
+                       FenestrationCommon::PropertySimple t_Property,
+                       std::vector<double> t_Values);
+
+        // Portion of the incoming beam that hits the material (for each incoming direction) and
+        // material property for each wavelength.
+        void setDiffuse(FenestrationCommon::Side t_Side,
+                        FenestrationCommon::PropertySimple t_Property,
+                        std::vector<double> t_MaterialFraction,
+                        std::vector<double> t_MaterialProperties);
+
+        [[nodiscard]] size_t numberOfWavelengths() const;
+
+        // BSDF matrices at given wavelength
+        [[nodiscard]] BSDFIntegrator at(size_t wavelengthIndex) const;
+
+    private:
+        struct Factors
+        {
+            std::vector<double> direct;
+            std::vector<double> materialFraction;
+            std::vector<double> materialProperties;
+        };
+
+        Factors & factors(FenestrationCommon::Side t_Side,
+                          FenestrationCommon::PropertySimple t_Property);
+
+        BSDFDirections m_Directions;
+        size_t m_NumberOfWavelengths;
+        std::map<std::pair<FenestrationCommon::Side, FenestrationCommon::PropertySimple>, Factors>
+          m_Factors;
+    };
+
+}   // namespace SingleLayerOptics
+
+#endif
@@ -102,12 +102,12 @@ namespace SingleLayerOptics
         return Abs(t_Side)[Index];
     }
 
-    std::vector<double> BSDFIntegrator::lambdaVector() const
+    const std::vector<double> & BSDFIntegrator::lambdaVector() const
     {
         return m_Directions.lambdaVector();
     }
 
-    SquareMatrix BSDFIntegrator::lambdaMatrix() const
+    const SquareMatrix & BSDFIntegrator::lambdaMatrix() const
     {
         return m_Directions.lambdaMatrix();
     }
@@ -147,6 +147,13 @@ namespace SingleLayerOptics
         return m_Directions.getNearestBeamIndex(t_Theta, t_Phi);
     }
 
+    std::vector<size_t>
+      BSDFIntegrator::getNearestBeamIndices(const std::vector<double> & t_Theta,
+                                            const std::vector<double> & t_Phi) const
+    {
+        return m_Directions.getNearestBeamIndices(t_Theta, t_Phi);
+    }
+
     void BSDFIntegrator::calcHemispherical()
     {
         if(!m_DirectHemisphericalCalculated)
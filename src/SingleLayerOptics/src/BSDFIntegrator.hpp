@@ -67,10 +67,13 @@ namespace SingleLayerOptics
         [[nodiscard]] double AbsDiffDiff(FenestrationCommon::Side t_Side);
 
         // Lambda values for the layer.
-        [[nodiscard]] std::vector<double> lambdaVector() const;
-        [[nodiscard]] FenestrationCommon::SquareMatrix lambdaMatrix() const;
+        [[nodiscard]] const std::vector<double> & lambdaVector() const;
+        [[nodiscard]] const FenestrationCommon::SquareMatrix & lambdaMatrix() const;
 
         [[nodiscard]] size_t getNearestBeamIndex(double t_Theta, double t_Phi) const;
+        [[nodiscard]] std::vector<size_t>
+          getNearestBeamIndices(const std::vector<double> & t_Theta,
+                                const std::vector<double> & t_Phi) const;
 
     protected:
         BSDFDirections m_Directions;
@@ -20,6 +20,7 @@ namespace SingleLayerOptics
     {
         // TODO: Maybe to refactor results to incoming and outgoing if not affecting speed.
         // This is not necessary before axisymmetry is introduced
+        m_Cell->precalculateGeometry(m_BSDFHemisphere.getDirections(BSDFDirection::Incoming));
     }
 
     void CBSDFLayer::setSourceData(CSeries & t_SourceData)
@@ -50,12 +51,26 @@ namespace SingleLayerOptics
 
     BSDFIntegrator CBSDFLayer::getResultsAtWavelength(size_t wavelengthIndex)
     {
-        BSDFIntegrator results{m_BSDFHemisphere.getDirections(BSDFDirection::Incoming)};
+        const auto & aDirections{m_BSDFHemisphere.getDirections(BSDFDirection::Incoming)};
+        m_Cell->calculateDirectionsAtWavelength(aDirections, wavelengthIndex);
+
+        BSDFIntegrator results{aDirections};
         calculate_dir_dir_wl(wavelengthIndex, results);
         calculate_dir_dif_wv(wavelengthIndex, results);
         return results;
     }
 
+    void CBSDFLayer::calculateDirectionsAtWavelengths()
+    {
+        m_Cell->calculateDirectionsAtWavelengths(
+          m_BSDFHemisphere.getDirections(BSDFDirection::Incoming));
+    }
+
+    std::optional<BSDFFactoredResults> CBSDFLayer::getFactoredResults()
+    {
+        return std::nullopt;
+    }
+
     void CBSDFLayer::calculate_dir_dir_wl(size_t wavelengthIndex, BSDFIntegrator & results)
     {
         for(Side aSide : EnumSide())
@@ -66,9 +81,9 @@ namespace SingleLayerOptics
             {
                 const CBeamDirection aDirection = aDirections[i].centerPoint();
                 const auto aTau =
-                  m_Cell->T_dir_dir_at_wavelength(aSide, aDirection, wavelengthIndex);
+                  m_Cell->T_dir_dir_at_direction(aSide, aDirection, i, wavelengthIndex);
                 const auto aRho =
-                  m_Cell->R_dir_dir_at_wavelength(aSide, aDirection, wavelengthIndex);
+                  m_Cell->R_dir_dir_at_direction(aSide, aDirection, i, wavelengthIndex);
                 double Lambda = aDirections[i].lambda();
 
                 auto & tau = results.getMatrix(aSide, PropertySimple::T);
@@ -112,7 +127,7 @@ namespace SingleLayerOptics
     {
         for(Side t_Side : EnumSide())
         {
-            BSDFDirections aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
+            const auto & aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
             size_t size = aDirections.size();
             SquareMatrix tau{size};
             SquareMatrix rho{size};
@@ -187,13 +202,19 @@ namespace SingleLayerOptics
 
     void CBSDFLayer::calculate()
     {
+        m_Cell->calculateDirections(m_BSDFHemisphere.getDirections(BSDFDirection::Incoming));
         calc_dir_dir();
         calc_dir_dif();
     }
 
     std::vector<BSDFIntegrator> CBSDFLayer::calculate_wv()
     {
-        std::vector<BSDFIntegrator> results(m_Cell->getBandSize(), m_BSDFHemisphere.getDirections(BSDFDirection::Incoming));
+        const auto & aDirections{m_BSDFHemisphere.getDirections(BSDFDirection::Incoming)};
+        const auto bandSize{m_Cell->getBandSize()};
+
+        m_Cell->calculateDirectionsAtWavelengths(aDirections);
+
+        std::vector<BSDFIntegrator> results(bandSize, aDirections);
 
         calc_dir_dir_wv(results);
         calc_dir_dif_wv(results);
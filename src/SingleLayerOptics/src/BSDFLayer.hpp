@@ -2,10 +2,12 @@
 #define BASEBSDFLAYERMULTIWL_H
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "BSDFDirections.hpp"
 #include "BSDFIntegrator.hpp"
+#include "BSDFFactoredResults.hpp"
 
 namespace FenestrationCommon
 {
@@ -44,6 +46,14 @@ namespace SingleLayerOptics
         std::vector<BSDFIntegrator> getWavelengthResults();
         BSDFIntegrator getResultsAtWavelength(size_t wavelengthIndex);
 
+        // Results for each wavelength in the factored form. Layers that cannot be factored will
+        // return empty value and results must be calculated with getResultsAtWavelength.
+        [[nodiscard]] virtual std::optional<BSDFFactoredResults> getFactoredResults();
+
+        // Prepares cell for getResultsAtWavelength calls over the whole material band. Cells can
+        // calculate all wavelengths at once which is faster than doing it one by one.
+        void calculateDirectionsAtWavelengths();
+
         int getBandIndex(double t_Wavelength);
 
         std::vector<double> getBandWavelengths() const;
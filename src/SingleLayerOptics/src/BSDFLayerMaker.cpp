@@ -3,6 +3,7 @@
 
 #include "BSDFLayerMaker.hpp"
 #include "UniformDiffuseCell.hpp"
+#include "PerfectDiffuseCell.hpp"
 #include "DirectionalDiffuseCell.hpp"
 #include "UniformDiffuseBSDFLayer.hpp"
 #include "DirectionalDiffuseBSDFLayer.hpp"
@@ -120,7 +121,7 @@ namespace SingleLayerOptics
                                                 const BSDFHemisphere & t_BSDF)
     {
         auto aDescription = std::make_shared<CFlatCellDescription>();
-        auto aCell = std::make_shared<CUniformDiffuseCell>(t_Material, aDescription);
+        auto aCell = std::make_shared<CPerfectDiffuseCell>(t_Material, aDescription);
         return std::make_shared<CUniformDiffuseBSDFLayer>(aCell, t_BSDF);
     }
 
@@ -75,6 +75,16 @@ namespace SingleLayerOptics
         return m_Theta.isInLimits(t_Theta) && m_Phi.isInLimits(t_Phi);
     }
 
+    const AngleLimits & CBSDFPatch::theta() const
+    {
+        return m_Theta;
+    }
+
+    const AngleLimits & CBSDFPatch::phi() const
+    {
+        return m_Phi;
+    }
+
     double CBSDFPatch::calculateLambda(double lowerTheta, double upperTheta, double phiDelta)
     {
         using ConstantsData::WCE_PI;
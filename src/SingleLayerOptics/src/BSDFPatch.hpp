@@ -32,6 +32,8 @@ namespace SingleLayerOptics
         [[nodiscard]] CBeamDirection centerPoint() const;
         [[nodiscard]] double lambda() const;
         [[nodiscard]] bool isInPatch(double t_Theta, double t_Phi) const;
+        [[nodiscard]] const AngleLimits & theta() const;
+        [[nodiscard]] const AngleLimits & phi() const;
 
     private:
         double calculateLambda(double lowerTheta, double upperTheta, double phiDelta);
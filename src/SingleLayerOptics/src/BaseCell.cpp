@@ -25,6 +25,25 @@ namespace SingleLayerOptics
         m_Material->setSourceData(t_SourceData);
     }
 
+    void CBaseCell::precalculateGeometry(const BSDFDirections &)
+    {}
+
+    void CBaseCell::calculateDirections(const BSDFDirections &)
+    {}
+
+    void CBaseCell::calculateDirectionsAtWavelength(const BSDFDirections &, size_t)
+    {}
+
+    void CBaseCell::calculateDirectionsAtWavelengths(const BSDFDirections & t_Directions)
+    {
+        parallel_for(0u, getBandSize(), [&](const size_t start, const size_t end) {
+            for(size_t i = start; i < end; ++i)
+            {
+                calculateDirectionsAtWavelength(t_Directions, i);
+            }
+        });
+    }
+
     double CBaseCell::T_dir_dir(const Side t_Side, const CBeamDirection & t_Direction)
     {
         if(m_CellRotation != 0)
@@ -87,6 +106,24 @@ namespace SingleLayerOptics
         return R_dir_dir(t_Side, t_Direction);
     }
 
+    double CBaseCell::T_dir_dir_at_direction(const Side t_Side,
+                                             const CBeamDirection & t_Direction,
+                                             size_t t_DirectionIndex,
+                                             size_t wavelengthIndex)
+    {
+        std::ignore = t_DirectionIndex;
+        return T_dir_dir_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    double CBaseCell::R_dir_dir_at_direction(const Side t_Side,
+                                             const CBeamDirection & t_Direction,
+                                             size_t t_DirectionIndex,
+                                             size_t wavelengthIndex)
+    {
+        std::ignore = t_DirectionIndex;
+        return R_dir_dir_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
     std::vector<double> CBaseCell::getBandWavelengths() const
     {
         assert(m_Material != nullptr);
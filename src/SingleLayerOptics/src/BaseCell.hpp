@@ -16,6 +16,7 @@ namespace SingleLayerOptics
     class CMaterial;
     class ICellDescription;
     class CBeamDirection;
+    class BSDFDirections;
 
     // Handles optical layer "cell". Base behavior is to calculate specular (direct-direct)
     // component of a light beam. Inherit from this class when want to create new shading type.
@@ -30,6 +31,21 @@ namespace SingleLayerOptics
 
         virtual void setSourceData(FenestrationCommon::CSeries & t_SourceData);
 
+        // Called once when layer is created with the layer incoming directions. Cells can store
+        // geometric factors that do not depend on wavelength and read them back by direction
+        // index in the *_at_direction functions. Default cell does nothing.
+        virtual void precalculateGeometry(const BSDFDirections & t_Directions);
+
+        // Called before properties for the given incoming directions are requested. Cells that
+        // can calculate all directions at once (like venetian) are doing it here. Default cell
+        // does nothing.
+        virtual void calculateDirections(const BSDFDirections & t_Directions);
+        virtual void calculateDirectionsAtWavelength(const BSDFDirections & t_Directions,
+                                                     size_t wavelengthIndex);
+        // Same as calculateDirectionsAtWavelength for every wavelength of the material band.
+        // Default implementation calls calculateDirectionsAtWavelength in parallel loop.
+        virtual void calculateDirectionsAtWavelengths(const BSDFDirections & t_Directions);
+
         // Direct to direct component of transmitted ray
         // These dir_dir and dir_dir_band functions are returning only direct portion of the
         // incoming beam that goes directly through cell without interfering (bouncing off) with
@@ -53,6 +69,18 @@ namespace SingleLayerOptics
                                                const CBeamDirection & t_Direction,
                                                size_t wavelengthIndex);
 
+        // Same as *_at_wavelength functions for the layer direction with the given index. Default
+        // cell ignores the index.
+        virtual double T_dir_dir_at_direction(FenestrationCommon::Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              size_t t_DirectionIndex,
+                                              size_t wavelengthIndex);
+
+        virtual double R_dir_dir_at_direction(FenestrationCommon::Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              size_t t_DirectionIndex,
+                                              size_t wavelengthIndex);
+
         std::vector<double> getBandWavelengths() const;
         virtual void setBandWavelengths(const std::vector<double> & wavelengths);
         int getBandIndex(double t_Wavelength) const;
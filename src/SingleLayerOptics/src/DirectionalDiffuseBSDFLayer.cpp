@@ -37,14 +37,15 @@ namespace SingleLayerOptics
         auto & tau = m_Results.getMatrix(aSide, PropertySimple::T);
         auto & Rho = m_Results.getMatrix(aSide, PropertySimple::R);
 
-        const auto & jDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing);
+        const auto & jDirections =
+          m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing).centerPoints();
 
         size_t size = jDirections.size();
 
         for(size_t outgoingDirectionIndex = 0; outgoingDirectionIndex < size;
             ++outgoingDirectionIndex)
         {
-            const CBeamDirection jDirection = jDirections[outgoingDirectionIndex].centerPoint();
+            const auto & jDirection = jDirections[outgoingDirectionIndex];
 
             const double aTau = aCell->T_dir_dif(aSide, incomingDirection, jDirection);
             const double aRho = aCell->R_dir_dif(aSide, incomingDirection, jDirection);
@@ -63,14 +64,15 @@ namespace SingleLayerOptics
     {
         std::shared_ptr<CDirectionalDiffuseCell> aCell = cellAsDirectionalDiffuse();
 
-        const BSDFDirections oDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing);
+        const auto & oDirections =
+          m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing).centerPoints();
 
         size_t size = oDirections.size();
 
         for(size_t outgoingDirectionIndex = 0; outgoingDirectionIndex < size;
             ++outgoingDirectionIndex)
         {
-            const CBeamDirection oDirection = oDirections[outgoingDirectionIndex].centerPoint();
+            const auto & oDirection = oDirections[outgoingDirectionIndex];
 
             auto aTau = aCell->T_dir_dif_band(aSide, incomingDirection, oDirection);
             auto Ref = aCell->R_dir_dif_band(aSide, incomingDirection, oDirection);
@@ -97,14 +99,15 @@ namespace SingleLayerOptics
     {
         std::shared_ptr<CDirectionalDiffuseCell> aCell = cellAsDirectionalDiffuse();
 
-        const BSDFDirections oDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing);
+        const auto & oDirections =
+          m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing).centerPoints();
 
         size_t size = oDirections.size();
 
         for(size_t outgoingDirectionIndex = 0; outgoingDirectionIndex < size;
             ++outgoingDirectionIndex)
         {
-            const CBeamDirection oDirection = oDirections[outgoingDirectionIndex].centerPoint();
+            const auto & oDirection = oDirections[outgoingDirectionIndex];
 
             auto aTau =
               aCell->T_dir_dif_by_wavelength(aSide, incomingDirection, oDirection, wavelengthIndex);
@@ -138,7 +141,8 @@ namespace SingleLayerOptics
 
     double CMatrixBSDFLayer::diffuseDistributionScalar(size_t outgoingDirection)
     {
-        const auto lambdas{m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing).lambdaVector()};
+        const auto & lambdas{
+          m_BSDFHemisphere.getDirections(BSDFDirection::Outgoing).lambdaVector()};
         return 1 / lambdas.at(outgoingDirection);
     }
 }   // namespace SingleLayerOptics
@@ -2,18 +2,10 @@
 #include <stdexcept>
 #include <sstream>
 
-#include <mutex>
-
 #include "MaterialDescription.hpp"
 #include "WCECommon.hpp"
 #include "OpticalSurface.hpp"
 
-std::mutex materialWL;
-std::mutex baseMaterialMutex;
-std::mutex materialSampleWL;
-std::mutex dualBandMaterialMutexRatio;
-std::mutex dualBandMaterialMutexRadiation;
-
 using namespace FenestrationCommon;
 using namespace SpectralAveraging;
 
@@ -121,6 +113,73 @@ namespace SingleLayerOptics
         return m_Surface.at(t_Side)->getProperty(t_Property);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    ////   CBandPropertiesCache
+    ////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<double> CBandPropertiesCache::properties(const Property t_Property,
+                                                         const Side t_Side,
+                                                         const double t_Theta,
+                                                         const Calculator & t_Calculator)
+    {
+        return *cached(t_Property, t_Side, t_Theta, t_Calculator);
+    }
+
+    double CBandPropertiesCache::property(const Property t_Property,
+                                          const Side t_Side,
+                                          const double t_Theta,
+                                          const size_t wavelengthIndex,
+                                          const Calculator & t_Calculator)
+    {
+        return (*cached(t_Property, t_Side, t_Theta, t_Calculator))[wavelengthIndex];
+    }
+
+    void CBandPropertiesCache::clear()
+    {
+        std::lock_guard<InstanceMutex> lock(m_Mutex);
+        m_Properties.clear();
+        m_Order.clear();
+    }
+
+    size_t CBandPropertiesCache::size() const
+    {
+        std::lock_guard<InstanceMutex> lock(m_Mutex);
+        return m_Properties.size();
+    }
+
+    CBandPropertiesCache::Values CBandPropertiesCache::cached(const Property t_Property,
+                                                              const Side t_Side,
+                                                              const double t_Theta,
+                                                              const Calculator & t_Calculator)
+    {
+        const Key key{t_Property, t_Side, t_Theta};
+        {
+            std::lock_guard<InstanceMutex> lock(m_Mutex);
+            const auto it{m_Properties.find(key)};
+            if(it != m_Properties.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Values are shared so they stay valid for the caller even if entry is removed meanwhile
+        auto values{std::make_shared<const std::vector<double>>(t_Calculator())};
+
+        std::lock_guard<InstanceMutex> lock(m_Mutex);
+        // Other thread could calculate the same entry in the meantime. The first one is kept.
+        const auto [it, inserted]{m_Properties.emplace(key, std::move(values))};
+        if(inserted)
+        {
+            m_Order.push_back(key);
+            if(m_Order.size() > maximumSize)
+            {
+                m_Properties.erase(m_Order.front());
+                m_Order.pop_front();
+            }
+        }
+        return it->second;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     ////   CMaterial
     ////////////////////////////////////////////////////////////////////////////////////
@@ -184,7 +243,7 @@ namespace SingleLayerOptics
 
     std::vector<double> CMaterial::getBandWavelengths()
     {
-        std::lock_guard<std::mutex> lock(materialWL);
+        std::lock_guard<InstanceMutex> lock(m_WavelengthsMutex);
         if(!m_WavelengthsCalculated)
         {
             m_Wavelengths = calculateBandWavelengths();
@@ -201,7 +260,7 @@ namespace SingleLayerOptics
 
     void CMaterial::setBandWavelengths(const std::vector<double> & wavelengths)
     {
-        std::lock_guard<std::mutex> lock(baseMaterialMutex);
+        std::lock_guard<InstanceMutex> lock(m_WavelengthsMutex);
         m_Wavelengths = wavelengths;
         m_WavelengthsCalculated = true;
     }
@@ -375,7 +434,7 @@ namespace SingleLayerOptics
     {
         createNIRRange(m_MaterialVisibleRange, m_MaterialSolarRange, t_Ratio);
 
-        std::lock_guard<std::mutex> lock(dualBandMaterialMutexRatio);
+        std::lock_guard<InstanceMutex> lock(m_WavelengthsMutex);
         if(!m_WavelengthsCalculated)
         {
             m_Wavelengths = calculateBandWavelengths();
@@ -387,7 +446,7 @@ namespace SingleLayerOptics
     {
         createNIRRange(m_MaterialVisibleRange, m_MaterialSolarRange, ConstantsData::NIRRatio);
 
-        std::lock_guard<std::mutex> lock(dualBandMaterialMutexRadiation);
+        std::lock_guard<InstanceMutex> lock(m_WavelengthsMutex);
         if(!m_WavelengthsCalculated)
         {
             m_Wavelengths = calculateBandWavelengths();
@@ -433,11 +492,13 @@ namespace SingleLayerOptics
     void CMaterialSample::setSourceData(CSeries & t_SourceData)
     {
         m_AngularSample->setSourceData(t_SourceData);
+        m_BandProperties.clear();
     }
 
     void CMaterialSample::setDetectorData(FenestrationCommon::CSeries & t_DetectorData)
     {
         m_AngularSample->setDetectorData(t_DetectorData);
+        m_BandProperties.clear();
     }
 
     double CMaterialSample::getProperty(const Property t_Property,
@@ -457,18 +518,23 @@ namespace SingleLayerOptics
                                          const CBeamDirection &) const
     {
         assert(m_AngularSample);
-        return m_AngularSample->getWavelengthProperties(
-          t_Property, t_Side, t_IncomingDirection.theta());
+        const auto theta{t_IncomingDirection.theta()};
+        return m_BandProperties.properties(t_Property, t_Side, theta, [&]() {
+            return m_AngularSample->getWavelengthProperties(t_Property, t_Side, theta);
+        });
     }
 
     double CMaterialSample::getBandProperty(FenestrationCommon::Property t_Property,
                                             FenestrationCommon::Side t_Side,
                                             size_t wavelengthIndex,
                                             const CBeamDirection & t_IncomingDirection,
-                                            const CBeamDirection & t_OutgoingDirection) const
+                                            const CBeamDirection &) const
     {
-        return getBandProperties(
-          t_Property, t_Side, t_IncomingDirection, t_OutgoingDirection)[wavelengthIndex];
+        assert(m_AngularSample);
+        const auto theta{t_IncomingDirection.theta()};
+        return m_BandProperties.property(t_Property, t_Side, theta, wavelengthIndex, [&]() {
+            return m_AngularSample->getWavelengthProperties(t_Property, t_Side, theta);
+        });
     }
 
 
@@ -479,16 +545,15 @@ namespace SingleLayerOptics
 
     void CMaterialSample::setBandWavelengths(const std::vector<double> & wavelengths)
     {
-        std::lock_guard<std::mutex> lock(materialSampleWL);
-
         CMaterial::setBandWavelengths(wavelengths);
-        m_AngularSample->setBandWavelengths(m_Wavelengths);
-        m_WavelengthsCalculated = true;
+        m_AngularSample->setBandWavelengths(wavelengths);
+        m_BandProperties.clear();
     }
 
     void CMaterialSample::Flipped(bool flipped)
     {
         m_AngularSample->Flipped(flipped);
+        m_BandProperties.clear();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -528,6 +593,7 @@ namespace SingleLayerOptics
     void CMaterialMeasured::setSourceData(CSeries & t_SourceData)
     {
         m_AngularMeasurements->setSourceData(t_SourceData);
+        m_BandProperties.clear();
     }
 
     double CMaterialMeasured::getProperty(const Property t_Property,
@@ -548,10 +614,32 @@ namespace SingleLayerOptics
                                            const Side t_Side,
                                            const CBeamDirection & t_IncomingDirection,
                                            const CBeamDirection &) const
+    {
+        const auto theta{t_IncomingDirection.theta()};
+        return m_BandProperties.properties(t_Property, t_Side, theta, [&]() {
+            return calculateBandProperties(t_Property, t_Side, theta);
+        });
+    }
+
+    double CMaterialMeasured::getBandProperty(FenestrationCommon::Property t_Property,
+                                              FenestrationCommon::Side t_Side,
+                                              size_t wavelengthIndex,
+                                              const CBeamDirection & t_IncomingDirection,
+                                              const CBeamDirection &) const
+    {
+        const auto theta{t_IncomingDirection.theta()};
+        return m_BandProperties.property(t_Property, t_Side, theta, wavelengthIndex, [&]() {
+            return calculateBandProperties(t_Property, t_Side, theta);
+        });
+    }
+
+    std::vector<double> CMaterialMeasured::calculateBandProperties(const Property t_Property,
+                                                                   const Side t_Side,
+                                                                   const double t_Theta) const
     {
         assert(m_AngularMeasurements);
         std::shared_ptr<CSingleAngularMeasurement> aAngular =
-          m_AngularMeasurements->getMeasurements(t_IncomingDirection.theta());
+          m_AngularMeasurements->getMeasurements(t_Theta);
         std::shared_ptr<CSpectralSample> aSample = aAngular->getData();
         auto aProperties = aSample->getWavelengthsProperty(t_Property, t_Side);
 
@@ -568,16 +656,6 @@ namespace SingleLayerOptics
         return aValues;
     }
 
-    double CMaterialMeasured::getBandProperty(FenestrationCommon::Property t_Property,
-                                              FenestrationCommon::Side t_Side,
-                                              size_t wavelengthIndex,
-                                              const CBeamDirection & t_IncomingDirection,
-                                              const CBeamDirection & t_OutgoingDirection) const
-    {
-        return getBandProperties(
-          t_Property, t_Side, t_IncomingDirection, t_OutgoingDirection)[wavelengthIndex];
-    }
-
     std::vector<double> CMaterialMeasured::calculateBandWavelengths()
     {
         CSingleAngularMeasurement aAngular = *m_AngularMeasurements->getMeasurements(0.0);
@@ -613,7 +691,7 @@ namespace SingleLayerOptics
                                  BSDFHemisphere const & hemisphere,
                                  size_t incomingIdx)
     {
-        const auto outgoingLambdas =
+        const auto & outgoingLambdas =
           hemisphere.getDirections(BSDFDirection::Outgoing).lambdaVector();
 
         double result = 0;
@@ -648,7 +726,8 @@ namespace SingleLayerOptics
               m_Hemisphere.getDirections(BSDFDirection::Outgoing)
                 .getNearestBeamIndex(t_OutgoingDirection.theta(), t_OutgoingDirection.phi());
 
-            auto lambda{m_Hemisphere.getDirections(BSDFDirection::Outgoing).lambdaVector()};
+            const auto & lambda{
+              m_Hemisphere.getDirections(BSDFDirection::Outgoing).lambdaVector()};
 
             const auto val = m_Property.at({t_Property, t_Side})[outgoingIdx][incomingIdx];
 
@@ -4,6 +4,8 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <deque>
+#include <tuple>
 #include <functional>
 #include <WCESpectralAveraging.hpp>
 #include "BeamDirection.hpp"   //  Need to include rather than forward declare to default incoming and outgoing directions to CBeamDirection()
@@ -45,6 +47,53 @@ namespace SingleLayerOptics
         std::map<FenestrationCommon::Side, std::shared_ptr<CSurface>> m_Surface;
     };
 
+    //////////////////////////////////////////////////////////////////////////////////////////
+    ///   CBandPropertiesCache
+    //////////////////////////////////////////////////////////////////////////////////////////
+
+    //! \brief Keeps band properties of the material for every property, side and incidence angle.
+    //!
+    //! Band properties are calculated for all wavelengths at once. Keeping them allows access to
+    //! single band without recalculating whole vector. Calculation is done outside of the lock so
+    //! different angles can be calculated in parallel. Number of kept entries is limited and the
+    //! oldest ones are removed first.
+    class CBandPropertiesCache
+    {
+    public:
+        using Calculator = std::function<std::vector<double>()>;
+
+        std::vector<double> properties(FenestrationCommon::Property t_Property,
+                                       FenestrationCommon::Side t_Side,
+                                       double t_Theta,
+                                       const Calculator & t_Calculator);
+
+        double property(FenestrationCommon::Property t_Property,
+                        FenestrationCommon::Side t_Side,
+                        double t_Theta,
+                        size_t wavelengthIndex,
+                        const Calculator & t_Calculator);
+
+        void clear();
+
+        [[nodiscard]] size_t size() const;
+
+        static constexpr size_t maximumSize{512u};
+
+    private:
+        using Key = std::tuple<FenestrationCommon::Property, FenestrationCommon::Side, double>;
+        using Values = std::shared_ptr<const std::vector<double>>;
+
+        Values cached(FenestrationCommon::Property t_Property,
+                      FenestrationCommon::Side t_Side,
+                      double t_Theta,
+                      const Calculator & t_Calculator);
+
+        std::map<Key, Values> m_Properties;
+        //! Keys in order of insertion
+        std::deque<Key> m_Order;
+        mutable FenestrationCommon::InstanceMutex m_Mutex;
+    };
+
     //////////////////////////////////////////////////////////////////////////////////////////
     ///   CMaterial
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -114,6 +163,10 @@ namespace SingleLayerOptics
         virtual std::vector<double> calculateBandWavelengths() = 0;
         bool m_WavelengthsCalculated{false};
         std::vector<double> m_Wavelengths;
+
+        // Band wavelengths are calculated on first request and that can happen from several
+        // threads at the same time
+        FenestrationCommon::InstanceMutex m_WavelengthsMutex;
     };
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +416,9 @@ namespace SingleLayerOptics
     protected:
         std::vector<double> calculateBandWavelengths() override;
         std::shared_ptr<SpectralAveraging::CAngularSpectralSample> m_AngularSample;
+
+    private:
+        mutable CBandPropertiesCache m_BandProperties;
     };
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -423,7 +479,13 @@ namespace SingleLayerOptics
 
     private:
         std::vector<double> calculateBandWavelengths() override;
+        [[nodiscard]] std::vector<double>
+          calculateBandProperties(FenestrationCommon::Property t_Property,
+                                  FenestrationCommon::Side t_Side,
+                                  double t_Theta) const;
+
         std::shared_ptr<SpectralAveraging::CAngularMeasurements> m_AngularMeasurements;
+        mutable CBandPropertiesCache m_BandProperties;
     };
 
 
@@ -0,0 +1,19 @@
+#include "PerfectDiffuseCell.hpp"
+#include "CellDescription.hpp"
+#include "MaterialDescription.hpp"
+
+namespace SingleLayerOptics
+{
+    CPerfectDiffuseCell::CPerfectDiffuseCell(
+      const std::shared_ptr<CMaterial> & t_MaterialProperties,
+      const std::shared_ptr<ICellDescription> & t_Cell) :
+        CBaseCell(t_MaterialProperties, t_Cell),
+        CUniformDiffuseCell(t_MaterialProperties, t_Cell)
+    {}
+
+    bool CPerfectDiffuseCell::hasFactoredProperties() const
+    {
+        return true;
+    }
+
+}   // namespace SingleLayerOptics
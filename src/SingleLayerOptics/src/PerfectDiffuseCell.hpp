@@ -0,0 +1,24 @@
+#ifndef PERFECTDIFFUSECELL_H
+#define PERFECTDIFFUSECELL_H
+
+#include <memory>
+
+#include "UniformDiffuseCell.hpp"
+
+namespace SingleLayerOptics
+{
+    class ICellDescription;
+
+    // Flat cell made of uniformly diffusing material. Nothing goes through the cell directly.
+    class CPerfectDiffuseCell : public CUniformDiffuseCell
+    {
+    public:
+        CPerfectDiffuseCell(const std::shared_ptr<CMaterial> & t_MaterialProperties,
+                            const std::shared_ptr<ICellDescription> & t_Cell);
+
+        // Whole cell is covered with material so properties are material properties only
+        [[nodiscard]] bool hasFactoredProperties() const override;
+    };
+}   // namespace SingleLayerOptics
+
+#endif
@@ -15,4 +15,9 @@ namespace SingleLayerOptics
         CBaseCell(t_MaterialProperties, t_Cell),
         CUniformDiffuseCell(t_MaterialProperties, t_Cell)
     {}
+
+    bool CPerforatedCell::hasFactoredProperties() const
+    {
+        return true;
+    }
 }   // namespace SingleLayerOptics
@@ -19,6 +19,9 @@ namespace SingleLayerOptics
     public:
         CPerforatedCell(const std::shared_ptr<CMaterial> & t_MaterialProperties,
                         const std::shared_ptr<ICellDescription> & t_Cell);
+
+        // Direct components are geometry only and the rest of the cell is covered with material
+        [[nodiscard]] bool hasFactoredProperties() const override;
     };
 }   // namespace SingleLayerOptics
 
@@ -26,6 +26,47 @@ namespace SingleLayerOptics
         return aCell;
     }
 
+    std::optional<BSDFFactoredResults> CUniformDiffuseBSDFLayer::getFactoredResults()
+    {
+        auto aCell = cellAsUniformDiffuse();
+        if(!aCell->hasFactoredProperties())
+        {
+            return std::nullopt;
+        }
+
+        const auto & aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
+        const auto & aCenterPoints = aDirections.centerPoints();
+        const size_t size = aDirections.size();
+
+        BSDFFactoredResults results{aDirections, aCell->getBandSize()};
+        for(Side aSide : EnumSide())
+        {
+            std::vector<double> aTau(size);
+            std::vector<double> aRho(size);
+            std::vector<double> aCover(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                const double Lambda = aDirections[i].lambda();
+                aTau[i] = aCell->T_dir_dir(aSide, aCenterPoints[i]) / Lambda;
+                aRho[i] = aCell->R_dir_dir(aSide, aCenterPoints[i]) / Lambda;
+                aCover[i] = aCell->materialCoverFraction(aSide, aCenterPoints[i]);
+            }
+
+            results.setDirect(aSide, PropertySimple::T, std::move(aTau));
+            results.setDirect(aSide, PropertySimple::R, std::move(aRho));
+            results.setDiffuse(aSide,
+                               PropertySimple::T,
+                               aCover,
+                               aCell->materialBandProperties(Property::T, aSide));
+            results.setDiffuse(aSide,
+                               PropertySimple::R,
+                               std::move(aCover),
+                               aCell->materialBandProperties(Property::R, aSide));
+        }
+
+        return results;
+    }
+
     void CUniformDiffuseBSDFLayer::calcDiffuseDistribution(const Side aSide,
                                                            const CBeamDirection & t_Direction,
                                                            const size_t t_DirectionIndex)
@@ -38,7 +79,7 @@ namespace SingleLayerOptics
         double aTau = aCell->T_dir_dif(aSide, t_Direction);
         double Ref = aCell->R_dir_dif(aSide, t_Direction);
 
-        const BSDFDirections aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
+        const auto & aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
         size_t size = aDirections.size();
 
         for(size_t j = 0; j < size; ++j)
@@ -60,7 +101,7 @@ namespace SingleLayerOptics
         std::vector<double> aTau = aCell->T_dir_dif_band(aSide, t_Direction);
         std::vector<double> Ref = aCell->R_dir_dif_band(aSide, t_Direction);
 
-        const BSDFDirections aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
+        const auto & aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
         size_t size = aDirections.size();
 
         for(size_t i = 0; i < size; ++i)
@@ -87,10 +128,12 @@ namespace SingleLayerOptics
     {
         std::shared_ptr<CUniformDiffuseCell> aCell = cellAsUniformDiffuse();
 
-        const auto aTau = aCell->T_dir_dif_at_wavelength(aSide, t_Direction, wavelengthIndex);
-        const auto Ref = aCell->R_dir_dif_at_wavelength(aSide, t_Direction, wavelengthIndex);
+        const auto aTau =
+          aCell->T_dir_dif_at_direction(aSide, t_Direction, t_DirectionIndex, wavelengthIndex);
+        const auto Ref =
+          aCell->R_dir_dif_at_direction(aSide, t_Direction, t_DirectionIndex, wavelengthIndex);
 
-        const BSDFDirections aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
+        const auto & aDirections = m_BSDFHemisphere.getDirections(BSDFDirection::Incoming);
         size_t size = aDirections.size();
 
         for(size_t i = 0; i < size; ++i)
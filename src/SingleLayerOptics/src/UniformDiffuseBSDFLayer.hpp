@@ -15,6 +15,10 @@ namespace SingleLayerOptics
         CUniformDiffuseBSDFLayer(const std::shared_ptr<CUniformDiffuseCell> & t_Cell,
                                  const BSDFHemisphere & t_Hemisphere);
 
+        // Material fraction is geometry while material property is the only one that depends on
+        // wavelength.
+        [[nodiscard]] std::optional<BSDFFactoredResults> getFactoredResults() override;
+
     protected:
         std::shared_ptr<CUniformDiffuseCell> cellAsUniformDiffuse() const;
         void calcDiffuseDistribution(FenestrationCommon::Side aSide,
@@ -22,8 +22,8 @@ namespace SingleLayerOptics
 
     double CUniformDiffuseCell::R_dir_dif(const Side t_Side, const CBeamDirection & t_Direction)
     {
-        return ((1 - T_dir_dir(t_Side, t_Direction))
-                * m_Material->getProperty(Property::R, t_Side));
+        return materialCoverFraction(t_Side, t_Direction)
+               * m_Material->getProperty(Property::R, t_Side);
     }
 
     std::vector<double> CUniformDiffuseCell::T_dir_dif_band(const Side t_Side,
@@ -52,23 +52,66 @@ namespace SingleLayerOptics
         return getMaterialPropertyAtWavelength(Property::R, t_Side, t_Direction, wavelengthIndex);
     }
 
+    double CUniformDiffuseCell::T_dir_dif_at_direction(const Side t_Side,
+                                                       const CBeamDirection & t_Direction,
+                                                       size_t t_DirectionIndex,
+                                                       size_t wavelengthIndex)
+    {
+        std::ignore = t_DirectionIndex;
+        return T_dir_dif_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    double CUniformDiffuseCell::R_dir_dif_at_direction(const Side t_Side,
+                                                       const CBeamDirection & t_Direction,
+                                                       size_t t_DirectionIndex,
+                                                       size_t wavelengthIndex)
+    {
+        std::ignore = t_DirectionIndex;
+        return R_dir_dif_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    bool CUniformDiffuseCell::hasFactoredProperties() const
+    {
+        return false;
+    }
+
+    double CUniformDiffuseCell::materialCoverFraction(const Side t_Side,
+                                                      const CBeamDirection & t_Direction)
+    {
+        return 1 - T_dir_dir(t_Side, t_Direction);
+    }
+
+    std::vector<double> CUniformDiffuseCell::materialBandProperties(const Property t_Property,
+                                                                    const Side t_Side) const
+    {
+        const auto size{getBandSize()};
+        std::vector<double> aProperties;
+        aProperties.reserve(size);
+        for(size_t i = 0u; i < size; ++i)
+        {
+            aProperties.push_back(m_Material->getBandProperty(t_Property, t_Side, i));
+        }
+        return aProperties;
+    }
+
     double CUniformDiffuseCell::getMaterialProperty(const Property t_Property,
                                                     const Side t_Side,
                                                     const CBeamDirection & t_Direction)
     {
-        return ((1 - T_dir_dir(t_Side, t_Direction)) * m_Material->getProperty(t_Property, t_Side));
+        return materialCoverFraction(t_Side, t_Direction)
+               * m_Material->getProperty(t_Property, t_Side);
     }
 
     std::vector<double> CUniformDiffuseCell::getMaterialProperties(
       const Property t_Property, const Side t_Side, const CBeamDirection & t_Direction)
     {
-        double materialCoverFraction = 1 - T_dir_dir(t_Side, t_Direction);
+        const double coverFraction = materialCoverFraction(t_Side, t_Direction);
         std::vector<double> aMaterialProperties = m_Material->getBandProperties(t_Property, t_Side);
         std::vector<double> aProperty;
         aProperty.reserve(aMaterialProperties.size());
         for(const auto & materialProperty : aMaterialProperties)
         {
-            aProperty.push_back(materialCoverFraction * materialProperty);
+            aProperty.push_back(coverFraction * materialProperty);
         }
         return aProperty;
     }
@@ -79,8 +122,7 @@ namespace SingleLayerOptics
       const CBeamDirection & t_Direction,
       size_t wavelengthIndex)
     {
-        double materialCoverFraction = 1 - T_dir_dir(t_Side, t_Direction);
-        return materialCoverFraction
+        return materialCoverFraction(t_Side, t_Direction)
                * m_Material->getBandProperty(t_Property, t_Side, wavelengthIndex);
     }
 }   // namespace SingleLayerOptics
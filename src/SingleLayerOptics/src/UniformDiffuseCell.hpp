@@ -51,6 +51,33 @@ namespace SingleLayerOptics
                                                const CBeamDirection & t_Direction,
                                                size_t wavelengthIndex);
 
+        // Same as *_at_wavelength functions for the layer direction with the given index. Default
+        // cell ignores the index.
+        virtual double T_dir_dif_at_direction(FenestrationCommon::Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              size_t t_DirectionIndex,
+                                              size_t wavelengthIndex);
+
+        virtual double R_dir_dif_at_direction(FenestrationCommon::Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              size_t t_DirectionIndex,
+                                              size_t wavelengthIndex);
+
+        // Cell properties can be stored as geometry (over directions) and material (over
+        // wavelengths) separately when direct components do not depend on wavelength and diffuse
+        // components are material cover fraction multiplied by the material property. Cells
+        // that satisfy this opt in by overriding it.
+        [[nodiscard]] virtual bool hasFactoredProperties() const;
+
+        // Portion of the cell covered with the material for given incoming direction
+        double materialCoverFraction(FenestrationCommon::Side t_Side,
+                                     const CBeamDirection & t_Direction);
+
+        // Material property for each wavelength in the band
+        [[nodiscard]] std::vector<double>
+          materialBandProperties(FenestrationCommon::Property t_Property,
+                                 FenestrationCommon::Side t_Side) const;
+
     private:
         double getMaterialProperty(const FenestrationCommon::Property t_Property,
                                    const FenestrationCommon::Side t_Side,
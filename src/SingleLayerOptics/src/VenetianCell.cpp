@@ -1,18 +1,20 @@
 #include <cassert>
-#include <mutex>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <tuple>
 
 #include "VenetianCell.hpp"
 #include "VenetianCellDescription.hpp"
 #include "BeamDirection.hpp"
 #include "MaterialDescription.hpp"
+#include "BSDFDirections.hpp"
+#include "BSDFPatch.hpp"
 
 using namespace FenestrationCommon;
 
 namespace SingleLayerOptics
 {
-    std::mutex radianceMutex;
-    std::mutex irradianceMutex;
-
     ////////////////////////////////////////////////////////////////////////////////////////////
     //  CVenetianBase
     ////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,19 +46,37 @@ namespace SingleLayerOptics
     {}
 
     CVenetianCellEnergy::CVenetianCellEnergy(
-      const std::shared_ptr<CVenetianCellDescription> & t_Cell,
+      const std::shared_ptr<const SlatEnergyGeometry> & t_Geometry,
       const double Tf,
       const double Tb,
       const double Rf,
       const double Rb) :
-        m_Cell(t_Cell),
+        m_Geometry(t_Geometry),
+        m_Cell(m_Geometry->cell()),
         m_Tf(Tf),
         m_Tb(Tb),
         m_Rf(Rf),
         m_Rb(Rb),
-        m_SlatSegments(*m_Cell, m_Tf, m_Tb, m_Rf, m_Rb)
+        m_Factorization(std::make_shared<const LUFactorization>(
+          m_Geometry->energyMatrix(m_Tf, m_Tb, m_Rf, m_Rb)))
     {}
 
+    const SlatEnergyGeometry & CVenetianCellEnergy::geometry() const
+    {
+        return *m_Geometry;
+    }
+
+    const LUFactorization & CVenetianCellEnergy::factorization() const
+    {
+        return *m_Factorization;
+    }
+
+    std::vector<std::vector<double>>
+      CVenetianCellEnergy::solve(const std::vector<std::vector<double>> & t_RightHandSides) const
+    {
+        return m_Factorization->solve(t_RightHandSides);
+    }
+
     double CVenetianCellEnergy::T_dir_dir(const CBeamDirection & t_Direction)
     {
         return m_Cell->T_dir_dir(Side::Front, t_Direction);
@@ -64,18 +84,17 @@ namespace SingleLayerOptics
 
     double CVenetianCellEnergy::T_dir_dif(const CBeamDirection & t_Direction)
     {
-        const auto irradiance =
-          slatIrradiances(t_Direction, m_SlatSegments, m_SlatSegments.slatsEnergy);
+        const auto & slats{m_Geometry->segments()};
+        const auto irradiance = slatIrradiances(t_Direction, slats);
 
         // Total energy accounts for direct to direct component. That needs to be subtracted since
         // only direct to diffuse is of interest
-        return irradiance[m_SlatSegments.numberOfSegments].E_f - T_dir_dir(t_Direction);
+        return irradiance[slats.numberOfSegments].E_f - T_dir_dir(t_Direction);
     }
 
     double CVenetianCellEnergy::R_dir_dif(const CBeamDirection & t_Direction)
     {
-        const auto irradiance{
-          slatIrradiances(t_Direction, m_SlatSegments, m_SlatSegments.slatsEnergy)};
+        const auto irradiance{slatIrradiances(t_Direction, m_Geometry->segments())};
 
         return irradiance[0].E_b;
     }
@@ -83,8 +102,7 @@ namespace SingleLayerOptics
     double CVenetianCellEnergy::T_dir_dir(const CBeamDirection & t_IncomingDirection,
                                           const CBeamDirection & t_OutgoingDirection)
     {
-        const auto radiance{
-          slatRadiances(t_IncomingDirection, m_SlatSegments, m_SlatSegments.slatsEnergy)};
+        const auto radiance{slatRadiances(t_IncomingDirection, m_Geometry->segments())};
 
         std::vector<BeamSegmentView> BVF = beamVector(t_OutgoingDirection, Side::Back);
 
@@ -99,7 +117,7 @@ namespace SingleLayerOptics
         }
 
         // Area weighting. Needs to be multiplied with number of segments
-        double insideSegLength = m_Cell->segmentLength(m_SlatSegments.numberOfSegments);
+        double insideSegLength = m_Cell->segmentLength(m_Geometry->segments().numberOfSegments);
 
         assert(insideSegLength != 0);
 
@@ -109,8 +127,7 @@ namespace SingleLayerOptics
     double CVenetianCellEnergy::R_dir_dir(const CBeamDirection & t_IncomingDirection,
                                           const CBeamDirection & t_OutgoingDirection)
     {
-        const auto radiance =
-          slatRadiances(t_IncomingDirection, m_SlatSegments, m_SlatSegments.slatsEnergy);
+        const auto radiance = slatRadiances(t_IncomingDirection, m_Geometry->segments());
 
         std::vector<BeamSegmentView> BVF = beamVector(t_OutgoingDirection, Side::Front);
 
@@ -123,7 +140,7 @@ namespace SingleLayerOptics
         }
 
         // Area weighting. Needs to be multiplied with number of segments
-        double insideSegLength = m_Cell->segmentLength(m_SlatSegments.numberOfSegments);
+        double insideSegLength = m_Cell->segmentLength(m_Geometry->segments().numberOfSegments);
 
         assert(insideSegLength != 0);
 
@@ -132,39 +149,99 @@ namespace SingleLayerOptics
 
     double CVenetianCellEnergy::T_dif_dif()
     {
-        const auto numSeg{m_SlatSegments.numberOfSegments};
+        const auto & slats{m_Geometry->segments()};
 
-        auto B{diffuseVector(m_SlatSegments, m_Cell->viewFactors())};
+        const auto B{diffuseVector(slats, m_Cell->viewFactors())};
 
-        CLinearSolver aSolver;
-        std::vector<double> aSolution = aSolver.solveSystem(m_SlatSegments.slatsEnergy, B);
+        const auto aSolution{solve({B})[0]};
 
-        return aSolution[numSeg - 1];
+        return aSolution[slats.numberOfSegments - 1];
     }
 
     double CVenetianCellEnergy::R_dif_dif()
     {
-        auto B{diffuseVector(m_SlatSegments, m_Cell->viewFactors())};
+        const auto & slats{m_Geometry->segments()};
+
+        const auto B{diffuseVector(slats, m_Cell->viewFactors())};
 
-        CLinearSolver aSolver;
-        std::vector<double> aSolution = aSolver.solveSystem(m_SlatSegments.slatsEnergy, B);
+        const auto aSolution{solve({B})[0]};
 
-        return aSolution[m_SlatSegments.numberOfSegments];
+        return aSolution[slats.numberOfSegments];
+    }
+
+    void CVenetianCellEnergy::calculateIrradiances(const std::vector<CBeamDirection> & t_Directions)
+    {
+        std::vector<CBeamDirection> directions;
+        {
+            std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+            for(const auto & aDirection : t_Directions)
+            {
+                if(m_SlatIrradiances.find(aDirection) == m_SlatIrradiances.end())
+                {
+                    directions.push_back(aDirection);
+                }
+            }
+        }
+
+        calculateIrradiances(directions, irradianceVectors(directions));
+    }
+
+    void CVenetianCellEnergy::calculateIrradiances(
+      const std::vector<CBeamDirection> & t_Directions,
+      const std::vector<std::vector<double>> & t_RightHandSides)
+    {
+        // All directions are solved against the same factor at once
+        const auto aSolutions{solve(t_RightHandSides)};
+
+        const auto & slats{m_Geometry->segments()};
+        std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+        for(size_t i = 0u; i < t_Directions.size(); ++i)
+        {
+            m_SlatIrradiances.emplace(t_Directions[i],
+                                      irradiancesFromSolution(aSolutions[i], slats));
+        }
+    }
+
+    std::vector<std::vector<double>>
+      CVenetianCellEnergy::irradianceVectors(const std::vector<CBeamDirection> & t_Directions)
+    {
+        std::vector<std::vector<double>> B;
+        B.reserve(t_Directions.size());
+        for(const auto & aDirection : t_Directions)
+        {
+            B.push_back(irradianceVector(aDirection, m_Geometry->segments()));
+        }
+        return B;
     }
 
     std::vector<SegmentIrradiance>
       CVenetianCellEnergy::slatIrradiances(const CBeamDirection & t_IncomingDirection,
-                                           const SlatSegments & slats,
-                                           const FenestrationCommon::SquareMatrix & energy)
+                                           const SlatSegments & slats)
     {
-        std::lock_guard<std::mutex> lock(irradianceMutex);
-        if(m_SlatIrradiances.count(t_IncomingDirection))
         {
-            return m_SlatIrradiances.at(t_IncomingDirection);
+            std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+            const auto it{m_SlatIrradiances.find(t_IncomingDirection)};
+            if(it != m_SlatIrradiances.end())
+            {
+                return it->second;
+            }
         }
 
-        std::vector<SegmentIrradiance> aIrradiances;
+        // Calculation is done outside of the lock. If two threads request the same direction at
+        // the same time, both will calculate identical irradiances and the first one is stored.
+        const auto aSolution{solve({irradianceVector(t_IncomingDirection, slats)})[0]};
+        auto aIrradiances{irradiancesFromSolution(aSolution, slats)};
 
+        std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+        m_SlatIrradiances.emplace(t_IncomingDirection, aIrradiances);
+
+        return aIrradiances;
+    }
+
+    std::vector<double>
+      CVenetianCellEnergy::irradianceVector(const CBeamDirection & t_IncomingDirection,
+                                            const SlatSegments & slats)
+    {
         size_t numSeg{slats.numberOfSegments};
 
         // Beam view factors with percentage view
@@ -188,47 +265,55 @@ namespace SingleLayerOptics
             B.push_back(-BVF[index].viewFactor);
         }
 
-        CLinearSolver aSolver;
-        const auto aSolution{aSolver.solveSystem(energy, B)};
+        return B;
+    }
+
+    std::vector<SegmentIrradiance>
+      CVenetianCellEnergy::irradiancesFromSolution(const std::vector<double> & t_Solution,
+                                                   const SlatSegments & slats)
+    {
+        size_t numSeg{slats.numberOfSegments};
 
+        std::vector<SegmentIrradiance> aIrradiances;
+        aIrradiances.reserve(numSeg + 1);
         for(size_t i = 0; i <= numSeg; ++i)
         {
             SegmentIrradiance aIrr;
             if(i == 0)
             {
                 aIrr.E_f = 1;
-                aIrr.E_b = aSolution[numSeg + i];
+                aIrr.E_b = t_Solution[numSeg + i];
             }
             else if(i == numSeg)
             {
-                aIrr.E_f = aSolution[i - 1];
+                aIrr.E_f = t_Solution[i - 1];
                 aIrr.E_b = 0;
             }
             else
             {
-                aIrr.E_f = aSolution[i - 1];
-                aIrr.E_b = aSolution[numSeg + i];
+                aIrr.E_f = t_Solution[i - 1];
+                aIrr.E_b = t_Solution[numSeg + i];
             }
             aIrradiances.push_back(aIrr);
         }
 
-        m_SlatIrradiances[t_IncomingDirection] = aIrradiances;
-
         return aIrradiances;
     }
 
     std::vector<double>
       CVenetianCellEnergy::slatRadiances(const CBeamDirection & t_IncomingDirection,
-                                         const SlatSegments & slats,
-                                         const FenestrationCommon::SquareMatrix & energy)
+                                         const SlatSegments & slats)
     {
-        if(m_SlatRadiances.count(t_IncomingDirection))
         {
-            return m_SlatRadiances.at(t_IncomingDirection);
+            std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+            const auto it{m_SlatRadiances.find(t_IncomingDirection)};
+            if(it != m_SlatRadiances.end())
+            {
+                return it->second;
+            }
         }
 
-        const auto irradiance{slatIrradiances(t_IncomingDirection, slats, energy)};
-        m_SlatIrradiances[t_IncomingDirection] = irradiance;
+        const auto irradiance{slatIrradiances(t_IncomingDirection, slats)};
         size_t numSlats = irradiance.size();
         std::vector<double> aRadiances(2 * numSlats - 2);
         for(size_t i = 0; i < numSlats; ++i)
@@ -248,113 +333,12 @@ namespace SingleLayerOptics
             }
         }
 
-        m_SlatRadiances[t_IncomingDirection] = aRadiances;
+        std::lock_guard<InstanceMutex> lock(m_CacheMutex);
+        m_SlatRadiances.emplace(t_IncomingDirection, aRadiances);
 
         return aRadiances;
     }
 
-    FenestrationCommon::SquareMatrix SlatSegments::formEnergyMatrix(
-      FenestrationCommon::SquareMatrix && viewFactors, double Tf, double Tb, double Rf, double Rb)
-    {
-        size_t numSeg = numberOfSegments;
-
-        // Create energy matrix
-        SquareMatrix energy{2 * numSeg};
-
-        // Building upper left side of matrix
-        for(size_t i = 0; i < numSeg; ++i)
-        {
-            for(size_t j = 0; j < numSeg; ++j)
-            {
-                if(i != numSeg - 1)
-                {
-                    double value = viewFactors(b[i + 1], f[j]) * Tf + viewFactors(f[i], f[j]) * Rf;
-                    if(i == j)
-                    {
-                        value -= 1;
-                    }
-                    energy(j, i) = value;
-                }
-                else
-                {
-                    if(i != j)
-                    {
-                        energy(j, i) = 0;
-                    }
-                    else
-                    {
-                        energy(j, i) = -1;
-                    }
-                }
-            }
-        }
-
-        // Building lower left side of matrix
-        for(size_t i = 0; i < numSeg; ++i)
-        {
-            for(size_t j = 0; j < numSeg; ++j)
-            {
-                if(i != numSeg - 1)
-                {
-                    const double value =
-                      viewFactors(b[i + 1], b[j]) * Tf + viewFactors(f[i], b[j]) * Rf;
-                    energy(j + numSeg, i) = value;
-                }
-                else
-                {
-                    energy(j + numSeg, i) = 0;
-                }
-            }
-        }
-
-        // Building upper right side of matrix
-        for(size_t i = 0; i < numSeg; ++i)
-        {
-            for(size_t j = 0; j < numSeg; ++j)
-            {
-                if(i != 0)
-                {
-                    const double value =
-                      viewFactors(f[i - 1], f[j]) * Tb + viewFactors(b[i], f[j]) * Rb;
-                    energy(j, i + numSeg) = value;
-                }
-                else
-                {
-                    energy(j, i + numSeg) = 0;
-                }
-            }
-        }
-
-        // Building lower right side of matrix
-        for(size_t i = 0; i < numSeg; ++i)
-        {
-            for(size_t j = 0; j < numSeg; ++j)
-            {
-                if(i != 0)
-                {
-                    double value = viewFactors(f[i - 1], b[j]) * Tb + viewFactors(b[i], b[j]) * Rb;
-                    if(i == j)
-                    {
-                        value -= 1;
-                    }
-                    energy(j + numSeg, i + numSeg) = value;
-                }
-                else
-                {
-                    if(i != j)
-                    {
-                        energy(j + numSeg, i + numSeg) = 0;
-                    }
-                    else
-                    {
-                        energy(j + numSeg, i + numSeg) = -1;
-                    }
-                }
-            }
-        }
-        return energy;
-    }
-
     std::vector<double>
       CVenetianCellEnergy::diffuseVector(const SlatSegments & slats,
                                          FenestrationCommon::SquareMatrix && viewFactors)
@@ -374,7 +358,7 @@ namespace SingleLayerOptics
     std::vector<CVenetianCellEnergy::BeamSegmentView>
       CVenetianCellEnergy::beamVector(const CBeamDirection & t_Direction, const Side t_Side)
     {
-        size_t numSeg{m_SlatSegments.numberOfSegments};
+        size_t numSeg{m_Geometry->segments().numberOfSegments};
 
         const auto profileAngle{t_Side == Side::Front ? t_Direction.profileAngle()
                                                       : -t_Direction.profileAngle()};
@@ -416,8 +400,8 @@ namespace SingleLayerOptics
 
     CVenetianEnergy::CVenetianEnergy(
       const CMaterial & t_Material,
-      const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-      const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry)
+      const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+      const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry)
     {
         double Tf = t_Material.getProperty(Property::T, Side::Front);
         double Tb = t_Material.getProperty(Property::T, Side::Back);
@@ -431,8 +415,8 @@ namespace SingleLayerOptics
       const double Tb,
       const double Rf,
       const double Rb,
-      const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-      const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry)
+      const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+      const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry)
     {
         createForwardAndBackward(Tf, Tb, Rf, Rb, t_ForwardFlowGeometry, t_BackwardFlowGeometry);
     }
@@ -442,13 +426,21 @@ namespace SingleLayerOptics
         return m_CellEnergy.at(t_Side);
     }
 
+    void CVenetianEnergy::calculateIrradiances(const std::vector<CBeamDirection> & t_Directions)
+    {
+        for(auto & cell : m_CellEnergy)
+        {
+            cell.second.calculateIrradiances(t_Directions);
+        }
+    }
+
     void CVenetianEnergy::createForwardAndBackward(
       double Tf,
       double Tb,
       double Rf,
       double Rb,
-      const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-      const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry)
+      const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+      const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry)
     {
         assert(t_ForwardFlowGeometry != nullptr);
         assert(t_BackwardFlowGeometry != nullptr);
@@ -469,34 +461,98 @@ namespace SingleLayerOptics
         assert(t_Cell != nullptr);
         assert(t_MaterialProperties != nullptr);
 
+        m_SlatGeometry[Side::Front] =
+          std::make_shared<const SlatEnergyGeometry>(getCellAsVenetian());
+        m_SlatGeometry[Side::Back] =
+          std::make_shared<const SlatEnergyGeometry>(m_BackwardFlowCellDescription);
+
         generateVenetianEnergy();
     }
 
     void CVenetianCell::generateVenetianEnergy()
     {
-        const auto & venetianForwardGeometry{getCellAsVenetian()};
-        m_Energy =
-          CVenetianEnergy(*m_Material, venetianForwardGeometry, m_BackwardFlowCellDescription);
-        // Create energy states for entire material band
+        m_Energy = CVenetianEnergy(
+          *m_Material, m_SlatGeometry.at(Side::Front), m_SlatGeometry.at(Side::Back));
+
+        // Energy states for the material band are generated when they are needed for the first
+        // time. That avoids generating them on every change of source data or wavelengths.
+        std::lock_guard<InstanceMutex> lock(m_EnergiesBandMutex);
         m_EnergiesBand.clear();
-        std::vector<RMaterialProperties> aMat = m_Material->getBandProperties();
+        m_UniqueEnergies.clear();
+        m_EnergiesBandGenerated = false;
+    }
 
-        if(!aMat.empty())
-        {
-            size_t size = m_Material->getBandSize();
-            for(size_t i = 0; i < size; ++i)
+    void CVenetianCell::generateBandEnergies()
+    {
+        m_EnergiesBand.clear();
+        const std::vector<RMaterialProperties> aMat = m_Material->getBandProperties();
+
+        // Slats with single band or piecewise constant materials have identical properties at
+        // many wavelengths. Energy state is created only once for every unique material.
+        std::map<SlatProperties, size_t> uniqueIndex;
+        std::vector<SlatProperties> uniqueProperties;
+        std::vector<size_t> propertyIndex;
+        propertyIndex.reserve(aMat.size());
+        for(const auto & aProperties : aMat)
+        {
+            const SlatProperties key{aProperties.getProperty(Property::T, Side::Front),
+                                     aProperties.getProperty(Property::T, Side::Back),
+                                     aProperties.getProperty(Property::R, Side::Front),
+                                     aProperties.getProperty(Property::R, Side::Back)};
+            const auto it{uniqueIndex.emplace(key, uniqueProperties.size())};
+            if(it.second)
             {
-                double Tf = aMat[i].getProperty(Property::T, Side::Front);
-                double Tb = aMat[i].getProperty(Property::T, Side::Back);
-                double Rf = aMat[i].getProperty(Property::R, Side::Front);
-                double Rb = aMat[i].getProperty(Property::R, Side::Back);
+                uniqueProperties.push_back(key);
+            }
+            propertyIndex.push_back(it.first->second);
+        }
 
-                m_EnergiesBand.emplace_back(
-                  Tf, Tb, Rf, Rb, venetianForwardGeometry, m_BackwardFlowCellDescription);
+        // Every energy state borrows the same geometry and factors only its own energy matrix
+        const auto & forwardGeometry{m_SlatGeometry.at(Side::Front)};
+        const auto & backwardGeometry{m_SlatGeometry.at(Side::Back)};
+        m_UniqueEnergies.resize(uniqueProperties.size());
+        parallel_for(0u, uniqueProperties.size(), [&](const size_t start, const size_t end) {
+            for(size_t i = start; i < end; ++i)
+            {
+                const auto & [Tf, Tb, Rf, Rb] = uniqueProperties[i];
+                m_UniqueEnergies[i] = std::make_shared<CVenetianEnergy>(
+                  Tf, Tb, Rf, Rb, forwardGeometry, backwardGeometry);
             }
+        });
+
+        m_EnergiesBand.reserve(propertyIndex.size());
+        for(const auto index : propertyIndex)
+        {
+            m_EnergiesBand.push_back(m_UniqueEnergies[index]);
         }
     }
 
+    const std::vector<std::shared_ptr<CVenetianEnergy>> & CVenetianCell::bandEnergies()
+    {
+        std::lock_guard<InstanceMutex> lock(m_EnergiesBandMutex);
+        if(!m_EnergiesBandGenerated)
+        {
+            generateBandEnergies();
+            m_EnergiesBandGenerated = true;
+        }
+        return m_EnergiesBand;
+    }
+
+    CVenetianEnergy & CVenetianCell::energy()
+    {
+        return m_Energy;
+    }
+
+    CVenetianEnergy & CVenetianCell::bandEnergy(const size_t wavelengthIndex)
+    {
+        return *bandEnergies()[wavelengthIndex];
+    }
+
+    const SlatEnergyGeometry & CVenetianCell::slatGeometry(const Side t_Side) const
+    {
+        return *m_SlatGeometry.at(t_Side);
+    }
+
     void CVenetianCell::setSourceData(CSeries & t_SourceData)
     {
         CBaseCell::setSourceData(t_SourceData);
@@ -509,6 +565,60 @@ namespace SingleLayerOptics
         generateVenetianEnergy();
     }
 
+    void CVenetianCell::calculateDirections(const BSDFDirections & t_Directions)
+    {
+        m_Energy.calculateIrradiances(rotatedDirections(t_Directions));
+    }
+
+    void CVenetianCell::calculateDirectionsAtWavelength(const BSDFDirections & t_Directions,
+                                                        const size_t wavelengthIndex)
+    {
+        const auto & energies{bandEnergies()};
+        if(wavelengthIndex < energies.size())
+        {
+            energies[wavelengthIndex]->calculateIrradiances(rotatedDirections(t_Directions));
+        }
+    }
+
+    void CVenetianCell::calculateDirectionsAtWavelengths(const BSDFDirections & t_Directions)
+    {
+        // Generates unique energy states if they are not generated already
+        std::ignore = bandEnergies();
+
+        if(m_UniqueEnergies.empty())
+        {
+            return;
+        }
+
+        // Right hand sides depend only on geometry so they are calculated once for all materials.
+        // Wavelengths with identical slat properties share the energy state so every unique
+        // material is solved only once.
+        const auto aDirections{rotatedDirections(t_Directions)};
+        for(const auto aSide : EnumSide())
+        {
+            const auto rhs{m_UniqueEnergies[0]->getCell(aSide).irradianceVectors(aDirections)};
+            parallel_for(0u, m_UniqueEnergies.size(), [&](const size_t start, const size_t end) {
+                for(size_t i = start; i < end; ++i)
+                {
+                    m_UniqueEnergies[i]->getCell(aSide).calculateIrradiances(aDirections, rhs);
+                }
+            });
+        }
+    }
+
+    std::vector<CBeamDirection>
+      CVenetianCell::rotatedDirections(const BSDFDirections & t_Directions) const
+    {
+        std::vector<CBeamDirection> result;
+        result.reserve(t_Directions.size());
+        for(size_t i = 0u; i < t_Directions.size(); ++i)
+        {
+            const auto aDirection{t_Directions[i].centerPoint()};
+            result.push_back(m_CellRotation != 0 ? aDirection.rotate(m_CellRotation) : aDirection);
+        }
+        return result;
+    }
+
     double CVenetianCell::T_dir_dir(const Side t_Side, const CBeamDirection & t_Direction)
     {
         if(m_CellRotation != 0)
@@ -521,7 +631,7 @@ namespace SingleLayerOptics
     std::vector<double> CVenetianCell::T_dir_dir_band(const Side t_Side,
                                                       const CBeamDirection & t_Direction)
     {
-        size_t size = m_EnergiesBand.size();
+        const size_t size = bandEnergies().size();
         std::vector<double> aProperties;
         aProperties.reserve(size);
         for(size_t i = 0; i < size; ++i)
@@ -537,11 +647,11 @@ namespace SingleLayerOptics
     {
         if(m_CellRotation != 0)
         {
-            return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dir(
+            return bandEnergy(wavelengthIndex).getCell(t_Side).T_dir_dir(
               t_Direction.rotate(m_CellRotation));
         }
 
-        return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dir(t_Direction);
+        return bandEnergy(wavelengthIndex).getCell(t_Side).T_dir_dir(t_Direction);
     }
 
     double CVenetianCell::T_dir_dif(const Side t_Side, const CBeamDirection & t_Direction)
@@ -556,7 +666,7 @@ namespace SingleLayerOptics
     std::vector<double> CVenetianCell::T_dir_dif_band(const Side t_Side,
                                                       const CBeamDirection & t_Direction)
     {
-        size_t size = m_EnergiesBand.size();
+        const size_t size = bandEnergies().size();
         std::vector<double> aProperties;
         aProperties.reserve(size);
         for(size_t i = 0; i < size; ++i)
@@ -572,11 +682,11 @@ namespace SingleLayerOptics
     {
         if(m_CellRotation != 0)
         {
-            return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dif(
+            return bandEnergy(wavelengthIndex).getCell(t_Side).T_dir_dif(
               t_Direction.rotate(m_CellRotation));
         }
 
-        return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dif(t_Direction);
+        return bandEnergy(wavelengthIndex).getCell(t_Side).T_dir_dif(t_Direction);
     }
 
     double CVenetianCell::R_dir_dif(const Side t_Side, const CBeamDirection & t_Direction)
@@ -591,7 +701,7 @@ namespace SingleLayerOptics
     std::vector<double> CVenetianCell::R_dir_dif_band(const Side t_Side,
                                                       const CBeamDirection & t_Direction)
     {
-        size_t size = m_EnergiesBand.size();
+        const size_t size = bandEnergies().size();
         std::vector<double> aProperties;
         aProperties.reserve(size);
         for(size_t i = 0; i < size; ++i)
@@ -607,11 +717,11 @@ namespace SingleLayerOptics
     {
         if(m_CellRotation != 0)
         {
-            return m_EnergiesBand[wavelengthIndex].getCell(t_Side).R_dir_dif(
+            return bandEnergy(wavelengthIndex).getCell(t_Side).R_dir_dif(
               t_Direction.rotate(m_CellRotation));
         }
 
-        return m_EnergiesBand[wavelengthIndex].getCell(t_Side).R_dir_dif(t_Direction);
+        return bandEnergy(wavelengthIndex).getCell(t_Side).R_dir_dif(t_Direction);
     }
 
     double CVenetianCell::T_dir_dif(const Side t_Side,
@@ -630,7 +740,7 @@ namespace SingleLayerOptics
                                                       const CBeamDirection & t_IncomingDirection,
                                                       const CBeamDirection & t_OutgoingDirection)
     {
-        size_t size = m_EnergiesBand.size();
+        const size_t size = bandEnergies().size();
         std::vector<double> aProperties;
         aProperties.reserve(size);
         for(size_t i = 0; i < size; ++i)
@@ -648,12 +758,13 @@ namespace SingleLayerOptics
     {
         if(m_CellRotation != 0)
         {
-            return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dir(
+            return bandEnergy(wavelengthIndex).getCell(t_Side).T_dir_dir(
               t_IncomingDirection.rotate(m_CellRotation),
               t_OutgoingDirection.rotate(m_CellRotation));
         }
-        return m_EnergiesBand[wavelengthIndex].getCell(t_Side).T_dir_dir(t_IncomingDirection,
-                                                                         t_OutgoingDirection);
+        return bandEnergy(wavelengthIndex)
+          .getCell(t_Side)
+          .T_dir_dir(t_IncomingDirection, t_OutgoingDirection);
     }
 
     double CVenetianCell::R_dir_dif(const Side t_Side,
@@ -672,7 +783,7 @@ namespace SingleLayerOptics
                                                       const CBeamDirection & t_IncomingDirection,
                                                       const CBeamDirection & t_OutgoingDirection)
     {
-        size_t size = m_EnergiesBand.size();
+        const size_t size = bandEnergies().size();
         std::vector<double> aProperties;
         aProperties.reserve(size);
         for(size_t i = 0; i < size; ++i)
@@ -690,13 +801,14 @@ namespace SingleLayerOptics
     {
         if(m_CellRotation != 0)
         {
-            return m_EnergiesBand[wavelengthIndex].getCell(t_Side).R_dir_dir(
+            return bandEnergy(wavelengthIndex).getCell(t_Side).R_dir_dir(
               t_IncomingDirection.rotate(m_CellRotation),
               t_OutgoingDirection.rotate(m_CellRotation));
         }
 
-        return m_EnergiesBand[wavelengthIndex].getCell(t_Side).R_dir_dir(t_IncomingDirection,
-                                                                         t_OutgoingDirection);
+        return bandEnergy(wavelengthIndex)
+          .getCell(t_Side)
+          .R_dir_dir(t_IncomingDirection, t_OutgoingDirection);
     }
 
     double CVenetianCell::T_dif_dif(const Side t_Side)
@@ -709,12 +821,88 @@ namespace SingleLayerOptics
         return m_Energy.getCell(t_Side).R_dif_dif();
     }
 
-    SlatSegments::SlatSegments(
-      CVenetianCellDescription & cell, double Tf, double Tb, double Rf, double Rb) :
-        numberOfSegments(static_cast<size_t>(cell.numberOfSegments() / 2)),
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //  SlatEnergyGeometry
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    SlatEnergyGeometry::SlatEnergyGeometry(
+      const std::shared_ptr<CVenetianCellDescription> & t_Cell) :
+        m_Cell(t_Cell),
+        m_Segments(m_Cell->numberOfSegments() / 2),
+        m_Tf(2 * m_Segments.numberOfSegments),
+        m_Tb(2 * m_Segments.numberOfSegments),
+        m_Rf(2 * m_Segments.numberOfSegments),
+        m_Rb(2 * m_Segments.numberOfSegments)
+    {
+        const size_t numSeg{m_Segments.numberOfSegments};
+        const auto & b{m_Segments.b};
+        const auto & f{m_Segments.f};
+        const auto viewFactors{m_Cell->viewFactors()};
+
+        // Columns of left side of the matrix are irradiances leaving front side of the segment
+        // and columns of right side are irradiances leaving back side of the segment. Last
+        // segment on the left and first segment on the right are openings of the cell and they
+        // do not have slat material.
+        for(size_t i = 0; i < numSeg; ++i)
+        {
+            for(size_t j = 0; j < numSeg; ++j)
+            {
+                if(i != numSeg - 1)
+                {
+                    m_Tf(j, i) = viewFactors(b[i + 1], f[j]);
+                    m_Rf(j, i) = viewFactors(f[i], f[j]);
+                    m_Tf(j + numSeg, i) = viewFactors(b[i + 1], b[j]);
+                    m_Rf(j + numSeg, i) = viewFactors(f[i], b[j]);
+                }
+                if(i != 0)
+                {
+                    m_Tb(j, i + numSeg) = viewFactors(f[i - 1], f[j]);
+                    m_Rb(j, i + numSeg) = viewFactors(b[i], f[j]);
+                    m_Tb(j + numSeg, i + numSeg) = viewFactors(f[i - 1], b[j]);
+                    m_Rb(j + numSeg, i + numSeg) = viewFactors(b[i], b[j]);
+                }
+            }
+        }
+    }
+
+    const std::shared_ptr<CVenetianCellDescription> & SlatEnergyGeometry::cell() const
+    {
+        return m_Cell;
+    }
+
+    const SlatSegments & SlatEnergyGeometry::segments() const
+    {
+        return m_Segments;
+    }
+
+    SquareMatrix SlatEnergyGeometry::energyMatrix(const double Tf,
+                                                  const double Tb,
+                                                  const double Rf,
+                                                  const double Rb) const
+    {
+        const size_t size{m_Tf.size()};
+        SquareMatrix energy{size};
+        for(size_t i = 0; i < size; ++i)
+        {
+            for(size_t j = 0; j < size; ++j)
+            {
+                double value = m_Tf(i, j) * Tf + m_Rf(i, j) * Rf + m_Tb(i, j) * Tb + m_Rb(i, j) * Rb;
+                if(i == j)
+                {
+                    value -= 1;
+                }
+                energy(i, j) = value;
+            }
+        }
+        return energy;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    //  SlatSegments
+    ////////////////////////////////////////////////////////////////////////////////////////////
+    SlatSegments::SlatSegments(const size_t t_NumberOfSegments) :
+        numberOfSegments(t_NumberOfSegments),
         b(formBackSegments(numberOfSegments)),
-        f(formFrontSegments(numberOfSegments)),
-        slatsEnergy(formEnergyMatrix(cell.viewFactors(), Tf, Tb, Rf, Rb))
+        f(formFrontSegments(numberOfSegments))
     {}
 
     std::vector<size_t> SlatSegments::formFrontSegments(const size_t numOfSegments)
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <array>
 
 #include <WCECommon.hpp>
 
@@ -26,6 +27,7 @@ namespace SingleLayerOptics
 {
     class ICellDescription;
     class CVenetianCellDescription;
+    class BSDFDirections;
 
     class CVenetianBase : public CUniformDiffuseCell, public CDirectionalDiffuseCell
     {
@@ -47,6 +49,9 @@ namespace SingleLayerOptics
         double E_b;
     };
 
+    // Slat material properties in order Tf, Tb, Rf, Rb
+    using SlatProperties = std::array<double, 4>;
+
     ////////////////////////////////////////////////////////////////////
     // SlatSegments
     ////////////////////////////////////////////////////////////////////
@@ -55,26 +60,43 @@ namespace SingleLayerOptics
     class SlatSegments
     {
     public:
-        explicit SlatSegments(
-          CVenetianCellDescription & cell, double Tf, double Tb, double Rf, double Rb);
+        explicit SlatSegments(size_t t_NumberOfSegments);
         SlatSegments() = default;
         size_t numberOfSegments{0u};
         std::vector<size_t> b;
         std::vector<size_t> f;
-        FenestrationCommon::SquareMatrix slatsEnergy;
+
+        static std::vector<size_t> formFrontSegments(size_t numberOfSegments);
+        static std::vector<size_t> formBackSegments(size_t numberOfSegments);
+    };
+
+    ////////////////////////////////////////////////////////////////////
+    // SlatEnergyGeometry
+    ////////////////////////////////////////////////////////////////////
+
+    // Slat energy matrix is linear combination of matrices that depend only on the geometry:
+    // E = -I + Tf * G_Tf + Tb * G_Tb + Rf * G_Rf + Rb * G_Rb
+    // Geometry matrices are calculated once per cell description and shared by energy states of
+    // every slat material. Only factored energy matrix is kept for each material.
+    class SlatEnergyGeometry
+    {
+    public:
+        explicit SlatEnergyGeometry(const std::shared_ptr<CVenetianCellDescription> & t_Cell);
+
+        [[nodiscard]] const std::shared_ptr<CVenetianCellDescription> & cell() const;
+        [[nodiscard]] const SlatSegments & segments() const;
+
+        [[nodiscard]] FenestrationCommon::SquareMatrix
+          energyMatrix(double Tf, double Tb, double Rf, double Rb) const;
 
     private:
-        std::vector<size_t> formFrontSegments(size_t numberOfSegments);
-        std::vector<size_t> formBackSegments(size_t numberOfSegments);
-
-        // Energy matrix is valid for any incoming direction. Depends on geometry and will be
-        // calculated only once and stored into m_Energy field
-        FenestrationCommon::SquareMatrix
-          formEnergyMatrix(FenestrationCommon::SquareMatrix && viewFactors,
-                           double Tf,
-                           double Tb,
-                           double Rf,
-                           double Rb);
+        std::shared_ptr<CVenetianCellDescription> m_Cell;
+        SlatSegments m_Segments;
+
+        FenestrationCommon::SquareMatrix m_Tf;
+        FenestrationCommon::SquareMatrix m_Tb;
+        FenestrationCommon::SquareMatrix m_Rf;
+        FenestrationCommon::SquareMatrix m_Rb;
     };
 
     // Keeping intermediate results for backward and forward directions.
@@ -82,7 +104,7 @@ namespace SingleLayerOptics
     {
     public:
         CVenetianCellEnergy();
-        CVenetianCellEnergy(const std::shared_ptr<CVenetianCellDescription> & t_Cell,
+        CVenetianCellEnergy(const std::shared_ptr<const SlatEnergyGeometry> & t_Geometry,
                             double Tf,
                             double Tb,
                             double Rf,
@@ -100,6 +122,22 @@ namespace SingleLayerOptics
         double T_dif_dif();
         double R_dif_dif();
 
+        // Calculates slat irradiances for all incoming directions with single solution of the
+        // energy system. Results are stored and used by directional functions.
+        void calculateIrradiances(const std::vector<CBeamDirection> & t_Directions);
+
+        // Same as above with right hand sides that are already calculated. They depend only on
+        // geometry so they can be shared between energy states of different slat materials.
+        void calculateIrradiances(const std::vector<CBeamDirection> & t_Directions,
+                                  const std::vector<std::vector<double>> & t_RightHandSides);
+
+        // Right hand sides of the energy system for given incoming directions
+        [[nodiscard]] std::vector<std::vector<double>>
+          irradianceVectors(const std::vector<CBeamDirection> & t_Directions);
+
+        [[nodiscard]] const SlatEnergyGeometry & geometry() const;
+        [[nodiscard]] const FenestrationCommon::LUFactorization & factorization() const;
+
     private:
         // Keeps information about beam view factor and percentage view
         struct BeamSegmentView
@@ -111,15 +149,21 @@ namespace SingleLayerOptics
         };
 
         // Irradiances for given incoming direction
-        std::vector<SegmentIrradiance>
-          slatIrradiances(const CBeamDirection & t_IncomingDirection,
-                          const SlatSegments & slats,
-                          const FenestrationCommon::SquareMatrix & energy);
+        std::vector<SegmentIrradiance> slatIrradiances(const CBeamDirection & t_IncomingDirection,
+                                                       const SlatSegments & slats);
 
         // Radiances for given incoming direction
         std::vector<double> slatRadiances(const CBeamDirection & t_IncomingDirection,
-                                          const SlatSegments & slats,
-                                          const FenestrationCommon::SquareMatrix & energy);
+                                          const SlatSegments & slats);
+
+        // Right hand side of the energy system for given incoming direction
+        std::vector<double> irradianceVector(const CBeamDirection & t_IncomingDirection,
+                                             const SlatSegments & slats);
+
+        // Irradiances from the solution of the energy system
+        static std::vector<SegmentIrradiance>
+          irradiancesFromSolution(const std::vector<double> & t_Solution,
+                                  const SlatSegments & slats);
 
         // Creates diffuse to diffuse std::vector. Right hand side of the equation
         std::vector<double> diffuseVector(const SlatSegments & slats,
@@ -129,16 +173,25 @@ namespace SingleLayerOptics
         std::vector<BeamSegmentView> beamVector(const CBeamDirection & t_Direction,
                                                 FenestrationCommon::Side t_Side);
 
+        // Every solution of the energy system goes through the same substitution so results do
+        // not depend on how many directions are solved together
+        [[nodiscard]] std::vector<std::vector<double>>
+          solve(const std::vector<std::vector<double>> & t_RightHandSides) const;
+
+        std::shared_ptr<const SlatEnergyGeometry> m_Geometry;
         std::shared_ptr<CVenetianCellDescription> m_Cell;
         double m_Tf;
         double m_Tb;
         double m_Rf;
         double m_Rb;
 
-        SlatSegments m_SlatSegments;
+        // Energy matrix is factored only once and the factor is used to solve the system for any
+        // incoming direction
+        std::shared_ptr<const FenestrationCommon::LUFactorization> m_Factorization;
 
         std::map<CBeamDirection, std::vector<SegmentIrradiance>> m_SlatIrradiances;
         std::map<CBeamDirection, std::vector<double>> m_SlatRadiances;
+        FenestrationCommon::InstanceMutex m_CacheMutex;
     };
 
     class CVenetianEnergy
@@ -146,18 +199,21 @@ namespace SingleLayerOptics
     public:
         CVenetianEnergy();
         CVenetianEnergy(const CMaterial & t_Material,
-                        const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-                        const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry);
+                        const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+                        const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry);
 
         CVenetianEnergy(double Tf,
                         double Tb,
                         double Rf,
                         double Rb,
-                        const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-                        const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry);
+                        const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+                        const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry);
 
         [[nodiscard]] CVenetianCellEnergy & getCell(FenestrationCommon::Side t_Side);
 
+        // Calculates irradiances of both sides for all incoming directions
+        void calculateIrradiances(const std::vector<CBeamDirection> & t_Directions);
+
     private:
         // construction of forward and backward cells from both constructors have identical part of
         // the code
@@ -166,8 +222,8 @@ namespace SingleLayerOptics
           double Tb,
           double Rf,
           double Rb,
-          const std::shared_ptr<CVenetianCellDescription> & t_ForwardFlowGeometry,
-          const std::shared_ptr<CVenetianCellDescription> & t_BackwardFlowGeometry);
+          const std::shared_ptr<const SlatEnergyGeometry> & t_ForwardFlowGeometry,
+          const std::shared_ptr<const SlatEnergyGeometry> & t_BackwardFlowGeometry);
 
         std::map<FenestrationCommon::Side, CVenetianCellEnergy> m_CellEnergy;
     };
@@ -183,6 +239,11 @@ namespace SingleLayerOptics
 
         void setBandWavelengths(const std::vector<double> & wavelengths) override;
 
+        void calculateDirections(const BSDFDirections & t_Directions) override;
+        void calculateDirectionsAtWavelength(const BSDFDirections & t_Directions,
+                                             size_t wavelengthIndex) override;
+        void calculateDirectionsAtWavelengths(const BSDFDirections & t_Directions) override;
+
         double T_dir_dir(FenestrationCommon::Side t_Side,
                          const CBeamDirection & t_Direction) override;
 
@@ -244,15 +305,42 @@ namespace SingleLayerOptics
         double T_dif_dif(FenestrationCommon::Side t_Side);
         double R_dif_dif(FenestrationCommon::Side t_Side);
 
+        // Energy state used for the whole band and for the given wavelength. Wavelengths with
+        // identical slat properties share the same state.
+        [[nodiscard]] CVenetianEnergy & energy();
+        [[nodiscard]] CVenetianEnergy & bandEnergy(size_t wavelengthIndex);
+
+        // Geometry part of the energy matrix that is shared by all energy states of the cell
+        [[nodiscard]] const SlatEnergyGeometry &
+          slatGeometry(FenestrationCommon::Side t_Side) const;
+
     private:
         void generateVenetianEnergy();
+        void generateBandEnergies();
+        [[nodiscard]] std::vector<CBeamDirection>
+          rotatedDirections(const BSDFDirections & t_Directions) const;
+
+        // Energy states for material bands are created on first request
+        [[nodiscard]] const std::vector<std::shared_ptr<CVenetianEnergy>> & bandEnergies();
+
         // Energy calculations for whole band
         CVenetianEnergy m_Energy;
 
-        // Energy calculations for material range (wavelengths)
-        std::vector<CVenetianEnergy> m_EnergiesBand;
+        // Energy calculations for material range (wavelengths). Wavelengths with identical
+        // material properties are sharing the same energy state.
+        std::vector<std::shared_ptr<CVenetianEnergy>> m_EnergiesBand;
+
+        // Energy states for every unique slat material in the band
+        std::vector<std::shared_ptr<CVenetianEnergy>> m_UniqueEnergies;
+        bool m_EnergiesBandGenerated{false};
+        FenestrationCommon::InstanceMutex m_EnergiesBandMutex;
 
         std::shared_ptr<CVenetianCellDescription> m_BackwardFlowCellDescription;
+
+        // Geometry part of the energy matrix for forward and backward flow. It depends only on the
+        // cell description so it is created once and shared by all energy states.
+        std::map<FenestrationCommon::Side, std::shared_ptr<const SlatEnergyGeometry>>
+          m_SlatGeometry;
     };
 
 }   // namespace SingleLayerOptics
@@ -8,11 +8,13 @@
 
 namespace SingleLayerOptics
 {
-    CVenetianCellDescription::CVenetianCellDescription(const double t_SlatWidth,
-                                                       const double t_SlatSpacing,
-                                                       const double t_SlatTiltAngle,
-                                                       const double t_CurvatureRadius,
-                                                       const size_t t_NumOfSlatSegments) :
+    CVenetianCellDescription::CVenetianCellDescription(
+      const double t_SlatWidth,
+      const double t_SlatSpacing,
+      const double t_SlatTiltAngle,
+      const double t_CurvatureRadius,
+      const size_t t_NumOfSlatSegments,
+      std::shared_ptr<Viewer::CDirect2DRaysTables> t_RaysTables) :
         m_SlatWidth(t_SlatWidth),
         m_SlatSpacing(t_SlatSpacing),
         m_SlatTiltAngle(t_SlatTiltAngle),
@@ -29,7 +31,10 @@ namespace SingleLayerOptics
                  t_SlatTiltAngle,
                  t_CurvatureRadius,
                  t_NumOfSlatSegments,
-                 SegmentsDirection::Negative)
+                 SegmentsDirection::Negative),
+        m_RaysTables(t_RaysTables != nullptr ? std::move(t_RaysTables)
+                                             : std::make_shared<Viewer::CDirect2DRaysTables>()),
+        m_BeamGeometry(m_RaysTables)
     {
         Viewer::CViewSegment2D exteriorSegment(m_Bottom.geometry().lastPoint(),
                                                m_Top.geometry().firstPoint());
@@ -72,8 +77,12 @@ namespace SingleLayerOptics
         size_t m_NumOfSlatSegments = m_Top.numberOfSegments();
 
         std::shared_ptr<CVenetianCellDescription> aBackwardCell =
-          std::make_shared<CVenetianCellDescription>(
-            slatWidth, slatSpacing, slatTiltAngle, curvatureRadius, m_NumOfSlatSegments);
+          std::make_shared<CVenetianCellDescription>(slatWidth,
+                                                     slatSpacing,
+                                                     slatTiltAngle,
+                                                     curvatureRadius,
+                                                     m_NumOfSlatSegments,
+                                                     m_RaysTables);
 
         if(!m_ProfileAngles.empty())
         {
@@ -135,6 +144,11 @@ namespace SingleLayerOptics
         return m_NumOfSegments;
     }
 
+    std::shared_ptr<Viewer::CDirect2DRaysTables> CVenetianCellDescription::raysTables() const
+    {
+        return m_RaysTables;
+    }
+
     void CVenetianCellDescription::preCalculateForProfileAngles(
       FenestrationCommon::Side side, const std::vector<double> & t_ProfileAngles)
     {
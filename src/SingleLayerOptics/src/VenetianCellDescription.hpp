@@ -23,13 +23,17 @@ namespace SingleLayerOptics
     {
     public:
         virtual ~CVenetianCellDescription() = default;
-        CVenetianCellDescription(double t_SlatWidth,
-                                 double t_SlatSpacing,
-                                 double t_SlatTiltAngle,
-                                 double t_CurvatureRadius,
-                                 size_t t_NumOfSlatSegments);
-
-        // Makes exact copy of cell description
+        //! Precalculated beam tables are shared between cells that are given the same store. Cell
+        //! creates its own store when none is given.
+        CVenetianCellDescription(
+          double t_SlatWidth,
+          double t_SlatSpacing,
+          double t_SlatTiltAngle,
+          double t_CurvatureRadius,
+          size_t t_NumOfSlatSegments,
+          std::shared_ptr<Viewer::CDirect2DRaysTables> t_RaysTables = nullptr);
+
+        // Makes exact copy of cell description. Copy is using the same beam tables store.
         [[nodiscard]] std::shared_ptr<CVenetianCellDescription> getBackwardFlowCell() const;
         [[nodiscard]] size_t numberOfSegments() const;
         [[nodiscard]] double segmentLength(size_t Index) const;
@@ -52,6 +56,7 @@ namespace SingleLayerOptics
         [[nodiscard]] double slatTiltAngle() const;
         [[nodiscard]] double curvatureRadius() const;
         [[nodiscard]] size_t numOfSegments() const;
+        [[nodiscard]] std::shared_ptr<Viewer::CDirect2DRaysTables> raysTables() const;
 
         void preCalculateForProfileAngles(FenestrationCommon::Side side,
                                           const std::vector<double> & t_ProfileAngles);
@@ -70,6 +75,9 @@ namespace SingleLayerOptics
         // Complete enclosure from venetian cell
         Viewer::CGeometry2D m_Geometry;
 
+        //! Store of precalculated beam tables. It must be initialized before beam geometry.
+        std::shared_ptr<Viewer::CDirect2DRaysTables> m_RaysTables;
+
         // Geometry to handle direct to direct beam component
         Viewer::CGeometry2DBeam m_BeamGeometry;
 
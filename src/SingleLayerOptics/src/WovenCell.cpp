@@ -8,19 +8,34 @@
 #include "MaterialDescription.hpp"
 #include "WCECommon.hpp"
 #include "BeamDirection.hpp"
+#include "BSDFDirections.hpp"
 
 using namespace FenestrationCommon;
 
 namespace SingleLayerOptics
 {
+    namespace
+    {
+        // Front and back side are stored next to each other in the direction table
+        constexpr size_t sidesCount{2u};
+
+        size_t directionTableIndex(const Side t_Side, const size_t t_DirectionIndex)
+        {
+            return t_DirectionIndex * sidesCount + static_cast<size_t>(t_Side);
+        }
+    }   // namespace
+
     ////////////////////////////////////////////////////////////////////////////////////////////
     //  CWovenCell
     ////////////////////////////////////////////////////////////////////////////////////////////
     CWovenCell::CWovenCell(const std::shared_ptr<CMaterial> & t_MaterialProperties,
                            const std::shared_ptr<ICellDescription> & t_Cell) :
         CBaseCell(t_MaterialProperties, t_Cell),
-        CUniformDiffuseCell(t_MaterialProperties, t_Cell)
-    {}
+        CUniformDiffuseCell(t_MaterialProperties, t_Cell),
+        m_WovenDescription(std::dynamic_pointer_cast<CWovenCellDescription>(t_Cell))
+    {
+        assert(m_WovenDescription != nullptr);
+    }
 
     double CWovenCell::T_dir_dif(const Side t_Side, const CBeamDirection & t_Direction)
     {
@@ -40,12 +55,13 @@ namespace SingleLayerOptics
     std::vector<double> CWovenCell::T_dir_dif_band(const Side t_Side,
                                                    const CBeamDirection & t_Direction)
     {
-        const size_t size{m_Material->getBandSize()};
-        std::vector<double> result;
-        result.reserve(size);
-        for(size_t i = 0; i < size; ++i)
+        // Direction part of the scattering is the same for every wavelength
+        const auto aGeometry{scatterGeometry(t_Direction)};
+        const auto RScatterMat{materialBandProperties(Property::R, oppositeSide(t_Side))};
+        auto result{CUniformDiffuseCell::T_dir_dif_band(t_Side, t_Direction)};
+        for(size_t i = 0; i < result.size(); ++i)
         {
-            result.push_back(T_dir_dif_at_wavelength(t_Side, t_Direction, i));
+            result[i] += Tscatter(aGeometry, RScatterMat[i]);
         }
         return result;
     }
@@ -63,12 +79,12 @@ namespace SingleLayerOptics
     std::vector<double> CWovenCell::R_dir_dif_band(const Side t_Side,
                                                    const CBeamDirection & t_Direction)
     {
-        const size_t size{m_Material->getBandSize()};
-        std::vector<double> result;
-        result.reserve(size);
-        for(size_t i = 0; i < size; ++i)
+        const auto aGeometry{scatterGeometry(t_Direction)};
+        const auto RScatterMat{materialBandProperties(Property::R, oppositeSide(t_Side))};
+        auto result{CUniformDiffuseCell::R_dir_dif_band(t_Side, t_Direction)};
+        for(size_t i = 0; i < result.size(); ++i)
         {
-            result.push_back(R_dir_dif_at_wavelength(t_Side, t_Direction, i));
+            result[i] -= Tscatter(aGeometry, RScatterMat[i]);
         }
         return result;
     }
@@ -82,17 +98,80 @@ namespace SingleLayerOptics
         return RMaterial - Tsct;
     }
 
-    std::shared_ptr<CWovenCellDescription> CWovenCell::getCellAsWoven() const
+    void CWovenCell::precalculateGeometry(const BSDFDirections & t_Directions)
     {
-        if(std::dynamic_pointer_cast<CWovenCellDescription>(m_CellDescription) == nullptr)
+        const auto & aCenterPoints{t_Directions.centerPoints()};
+        m_DirectionGeometry.clear();
+        m_DirectionGeometry.reserve(aCenterPoints.size() * sidesCount);
+        for(const auto & aDirection : aCenterPoints)
         {
-            assert("Incorrectly assigned cell description.");
+            const auto aScatter{scatterGeometry(aDirection)};
+            for(auto aSide : EnumSide())
+            {
+                m_DirectionGeometry.push_back(
+                  {CUniformDiffuseCell::T_dir_dir(aSide, aDirection), aScatter});
+            }
         }
+    }
 
-        std::shared_ptr<CWovenCellDescription> aCell =
-          std::dynamic_pointer_cast<CWovenCellDescription>(m_CellDescription);
+    const CWovenCell::DirectionGeometry *
+      CWovenCell::directionGeometry(const Side t_Side, const size_t t_DirectionIndex) const
+    {
+        const auto index{directionTableIndex(t_Side, t_DirectionIndex)};
+        if(!m_UseDirectionTable || index >= m_DirectionGeometry.size())
+        {
+            return nullptr;
+        }
+        return &m_DirectionGeometry[index];
+    }
 
-        return aCell;
+    double CWovenCell::T_dir_dir_at_direction(const Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              const size_t t_DirectionIndex,
+                                              const size_t wavelengthIndex)
+    {
+        if(const auto * aGeometry{directionGeometry(t_Side, t_DirectionIndex)})
+        {
+            return aGeometry->openness;
+        }
+        return T_dir_dir_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    double CWovenCell::T_dir_dif_at_direction(const Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              const size_t t_DirectionIndex,
+                                              const size_t wavelengthIndex)
+    {
+        if(const auto * aGeometry{directionGeometry(t_Side, t_DirectionIndex)})
+        {
+            const auto Tmaterial{(1 - aGeometry->openness)
+                                 * m_Material->getBandProperty(Property::T, t_Side, wavelengthIndex)};
+            const auto RScatterMat{
+              m_Material->getBandProperty(Property::R, oppositeSide(t_Side), wavelengthIndex)};
+            return Tmaterial + Tscatter(aGeometry->scatter, RScatterMat);
+        }
+        return T_dir_dif_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    double CWovenCell::R_dir_dif_at_direction(const Side t_Side,
+                                              const CBeamDirection & t_Direction,
+                                              const size_t t_DirectionIndex,
+                                              const size_t wavelengthIndex)
+    {
+        if(const auto * aGeometry{directionGeometry(t_Side, t_DirectionIndex)})
+        {
+            const auto RMaterial{(1 - aGeometry->openness)
+                                 * m_Material->getBandProperty(Property::R, t_Side, wavelengthIndex)};
+            const auto RScatterMat{
+              m_Material->getBandProperty(Property::R, oppositeSide(t_Side), wavelengthIndex)};
+            return RMaterial - Tscatter(aGeometry->scatter, RScatterMat);
+        }
+        return R_dir_dif_at_wavelength(t_Side, t_Direction, wavelengthIndex);
+    }
+
+    void CWovenCell::useDirectionTable(const bool value)
+    {
+        m_UseDirectionTable = value;
     }
 
     double CWovenCell::Tscatter_single(const Side t_Side, const CBeamDirection & t_Direction)
@@ -114,38 +193,58 @@ namespace SingleLayerOptics
 
     double CWovenCell::Tscatter(const CBeamDirection & t_Direction, const double Rmat) const
     {
-        double Tsct{0};
-        if(Rmat > 0)
+        return Tscatter(scatterGeometry(t_Direction), Rmat);
+    }
+
+    CWovenCell::ScatterGeometry
+      CWovenCell::scatterGeometry(const CBeamDirection & t_Direction) const
+    {
+        ScatterGeometry result{false, 0, 0};
+        const double gamma = m_WovenDescription->gamma();
+        if(gamma < 1)
         {
             const double aAlt = degrees(t_Direction.Altitude());
             const double aAzm = degrees(t_Direction.Azimuth());
-            const auto & aCell = *getCellAsWoven();
-            const double gamma = aCell.gamma();
+            const double DeltaMax = 89.7 - 10 * gamma / 0.16;
+            const double Delta = std::pow(std::pow(aAlt, 2) + std::pow(aAzm, 2), 0.5);
+
+            double E = 0;
+            if(Delta > DeltaMax)
+            {
+                E = -(std::pow(std::abs(Delta - DeltaMax), 2.5)) / 600;
+                result.aboveMaxDeviation = true;
+                result.deviationFactor = std::max(0.0, (Delta - DeltaMax) / (90 - DeltaMax));
+            }
+            else
+            {
+                E = -(std::pow(std::abs(Delta - DeltaMax), 2)) / 600;
+            }
+            result.peakExponent = std::exp(E);
+        }
+        return result;
+    }
+
+    double CWovenCell::Tscatter(const ScatterGeometry & t_Geometry, const double Rmat) const
+    {
+        double Tsct{0};
+        if(Rmat > 0)
+        {
+            const double gamma = m_WovenDescription->gamma();
 
             if(gamma < 1)
             {
                 const double Tscattermax = 0.0229 * gamma + 0.2971 * Rmat
                                            - 0.03624 * std::pow(gamma, 2)
                                            + 0.04763 * std::pow(Rmat, 2) - 0.44416 * gamma * Rmat;
-                const double DeltaMax = 89.7 - 10 * gamma / 0.16;
-                const double Delta = std::pow(std::pow(aAlt, 2) + std::pow(aAzm, 2), 0.5);
                 const double PeakRatio = 1 / (0.2 * Rmat * (1 - gamma));
 
-                double E = 0;
-                if(Delta > DeltaMax)
-                {
-                    E = -(std::pow(std::abs(Delta - DeltaMax), 2.5)) / 600;
-                    Tsct = -0.2 * Rmat * Tscattermax * (1 - gamma)
-                           * std::max(0.0, (Delta - DeltaMax) / (90 - DeltaMax));
-                }
-                else
+                if(t_Geometry.aboveMaxDeviation)
                 {
-                    E = -(std::pow(std::abs(Delta - DeltaMax), 2)) / 600;
-                    Tsct = 0;
+                    Tsct = -0.2 * Rmat * Tscattermax * (1 - gamma) * t_Geometry.deviationFactor;
                 }
-                Tsct =
-                  Tsct
-                  + 0.2 * Rmat * Tscattermax * (1 - gamma) * (1 + (PeakRatio - 1) * std::exp(E));
+                Tsct = Tsct
+                       + 0.2 * Rmat * Tscattermax * (1 - gamma)
+                           * (1 + (PeakRatio - 1) * t_Geometry.peakExponent);
             }
 
             if(Tsct < 0)
@@ -34,8 +34,46 @@ namespace SingleLayerOptics
                                        const CBeamDirection & t_Direction,
                                        size_t wavelengthIndex) override;
 
+        // Openness and direction part of the scattered transmittance are stored for every side
+        // and every layer direction
+        void precalculateGeometry(const BSDFDirections & t_Directions) override;
+
+        double T_dir_dir_at_direction(FenestrationCommon::Side t_Side,
+                                      const CBeamDirection & t_Direction,
+                                      size_t t_DirectionIndex,
+                                      size_t wavelengthIndex) override;
+        double T_dir_dif_at_direction(FenestrationCommon::Side t_Side,
+                                      const CBeamDirection & t_Direction,
+                                      size_t t_DirectionIndex,
+                                      size_t wavelengthIndex) override;
+        double R_dir_dif_at_direction(FenestrationCommon::Side t_Side,
+                                      const CBeamDirection & t_Direction,
+                                      size_t t_DirectionIndex,
+                                      size_t wavelengthIndex) override;
+
+        // Switch between stored and calculated geometry. Both must give the same results.
+        void useDirectionTable(bool value);
+
     private:
-        std::shared_ptr<CWovenCellDescription> getCellAsWoven() const;
+        // Part of the scattered transmittance that depends only on the direction
+        struct ScatterGeometry
+        {
+            bool aboveMaxDeviation;
+            double deviationFactor;
+            double peakExponent;
+        };
+
+        struct DirectionGeometry
+        {
+            double openness;
+            ScatterGeometry scatter;
+        };
+
+        // Returns nullptr when table is not used or direction index is not in the table
+        [[nodiscard]] const DirectionGeometry * directionGeometry(FenestrationCommon::Side t_Side,
+                                                                  size_t t_DirectionIndex) const;
+
+        [[nodiscard]] ScatterGeometry scatterGeometry(const CBeamDirection & t_Direction) const;
 
         double Tscatter_single(FenestrationCommon::Side t_Side, const CBeamDirection & t_Direction);
         double Tscatter_at_wavelength(FenestrationCommon::Side t_Side,
@@ -44,6 +82,13 @@ namespace SingleLayerOptics
 
         // Calculates scattered part of reflection from woven
         double Tscatter(const CBeamDirection & t_Direction, double Rmat) const;
+        double Tscatter(const ScatterGeometry & t_Geometry, double Rmat) const;
+
+        std::shared_ptr<CWovenCellDescription> m_WovenDescription;
+
+        // Flat table indexed with direction index and side
+        std::vector<DirectionGeometry> m_DirectionGeometry;
+        bool m_UseDirectionTable{true};
     };
 
 }   // namespace SingleLayerOptics
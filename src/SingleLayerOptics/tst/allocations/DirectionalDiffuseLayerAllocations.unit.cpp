@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "WCESingleLayerOptics.hpp"
+
+using namespace SingleLayerOptics;
+using namespace FenestrationCommon;
+
+namespace
+{
+    std::atomic<size_t> numberOfAllocations{0u};
+}   // namespace
+
+// Counts all allocations made by the test program. This replaces global operators for the whole
+// executable which is why these tests are not part of SingleLayerOptics_tests.
+void * operator new(std::size_t size)
+{
+    ++numberOfAllocations;
+    if(void * ptr = std::malloc(size == 0u ? 1u : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+class TestDirectionalDiffuseLayerAllocations : public testing::Test
+{
+protected:
+    template<typename Function>
+    static size_t allocations(Function && t_Function)
+    {
+        const size_t start{numberOfAllocations};
+        t_Function();
+        return numberOfAllocations - start;
+    }
+};
+
+TEST_F(TestDirectionalDiffuseLayerAllocations, DirectionsAccess)
+{
+    SCOPED_TRACE("Begin Test: Accessing directions does not allocate memory.");
+
+    for(const auto basis : {BSDFBasis::Small, BSDFBasis::Quarter, BSDFBasis::Half, BSDFBasis::Full})
+    {
+        const auto aHemisphere{BSDFHemisphere::create(basis)};
+        const auto & aDirections{aHemisphere.getDirections(BSDFDirection::Outgoing)};
+
+        double sum{0};
+        const auto count{allocations([&]() {
+            const BSDFDirections aCopy{aDirections};
+            for(size_t i = 0u; i < aCopy.size(); ++i)
+            {
+                sum += aCopy.lambdaVector()[i] * aCopy.centerPoints()[i].theta();
+            }
+        })};
+
+        EXPECT_EQ(0u, count);
+        EXPECT_GT(sum, 0.0);
+    }
+}
+
+TEST_F(TestDirectionalDiffuseLayerAllocations, DISABLED_LayerMatrixFill)
+{
+    SCOPED_TRACE("Begin Test: Allocations while filling directional diffuse layer matrices.");
+
+    // Benchmark that only counts allocations. Run SingleLayerOptics_allocations with
+    // --gtest_also_run_disabled_tests
+    const auto aMaterial = Material::singleBandMaterial(0.1, 0.1, 0.7, 0.7);
+    const std::vector<std::pair<BSDFBasis, std::string>> bases{{BSDFBasis::Small, "Small"},
+                                                               {BSDFBasis::Quarter, "Quarter"},
+                                                               {BSDFBasis::Half, "Half"},
+                                                               {BSDFBasis::Full, "Full"}};
+    for(const auto & [basis, name] : bases)
+    {
+        const auto aHemisphere{BSDFHemisphere::create(basis)};
+        const auto aLayer{CBSDFLayerMaker::getDirectionalDiffuseLayer(aMaterial, aHemisphere)};
+
+        const auto count{allocations([&]() { std::ignore = aLayer->getResults(); })};
+
+        const auto size{aHemisphere.getDirections(BSDFDirection::Incoming).size()};
+        std::cout << name << " basis (" << size << " directions): " << count
+                  << " allocations for directional diffuse layer matrices" << std::endl;
+    }
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <tuple>
+
+#include "WCESingleLayerOptics.hpp"
+
+using namespace SingleLayerOptics;
+
+// Nearest beam index must be the same as the one found by checking all patches one by one.
+class TestBSDFDirectionsNearestIndex : public testing::Test
+{
+protected:
+    static std::optional<size_t>
+      linearSearch(const BSDFDirections & t_Directions, double t_Theta, double t_Phi)
+    {
+        for(size_t i = 0u; i < t_Directions.size(); ++i)
+        {
+            if(t_Directions[i].isInPatch(t_Theta, t_Phi))
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Limits of all patches together with values that are just below and above them. Phi angles
+    // are checked one circle below and above as well.
+    static std::vector<double> limitAngles(std::vector<double> t_Limits, const bool t_FullCircle)
+    {
+        std::sort(t_Limits.begin(), t_Limits.end());
+        t_Limits.erase(std::unique(t_Limits.begin(), t_Limits.end()), t_Limits.end());
+
+        std::vector<double> result;
+        for(const auto limit : t_Limits)
+        {
+            result.push_back(limit);
+            result.push_back(std::nextafter(limit, -std::numeric_limits<double>::infinity()));
+            result.push_back(std::nextafter(limit, std::numeric_limits<double>::infinity()));
+            if(t_FullCircle)
+            {
+                result.push_back(limit + 360);
+                result.push_back(limit - 360);
+            }
+        }
+        return result;
+    }
+
+    static void compareWithLinearSearch(const BSDFHemisphere & t_Hemisphere)
+    {
+        for(const auto direction : {BSDFDirection::Incoming, BSDFDirection::Outgoing})
+        {
+            const auto & aDirections{t_Hemisphere.getDirections(direction)};
+
+            std::vector<double> thetaLimits;
+            std::vector<double> phiLimits;
+            for(size_t i = 0u; i < aDirections.size(); ++i)
+            {
+                thetaLimits.push_back(aDirections[i].theta().low());
+                thetaLimits.push_back(aDirections[i].theta().high());
+                thetaLimits.push_back(aDirections[i].centerPoint().theta());
+                phiLimits.push_back(aDirections[i].phi().low());
+                phiLimits.push_back(aDirections[i].phi().high());
+                phiLimits.push_back(aDirections[i].centerPoint().phi());
+            }
+            for(auto angle = -10.0; angle <= 100.0; angle += 5.3)
+            {
+                thetaLimits.push_back(angle);
+            }
+            for(auto angle = -400.0; angle <= 800.0; angle += 17.3)
+            {
+                phiLimits.push_back(angle);
+            }
+
+            std::vector<double> thetas;
+            std::vector<double> phis;
+            std::vector<size_t> expected;
+            for(const auto theta : limitAngles(thetaLimits, false))
+            {
+                for(const auto phi : limitAngles(phiLimits, true))
+                {
+                    const auto correct{linearSearch(aDirections, theta, phi)};
+                    if(correct.has_value())
+                    {
+                        ASSERT_EQ(correct.value(), aDirections.getNearestBeamIndex(theta, phi))
+                          << "Theta: " << theta << ", Phi: " << phi;
+                        thetas.push_back(theta);
+                        phis.push_back(phi);
+                        expected.push_back(correct.value());
+                    }
+                    else
+                    {
+                        EXPECT_THROW(std::ignore = aDirections.getNearestBeamIndex(theta, phi),
+                                     std::runtime_error);
+                    }
+                }
+            }
+
+            EXPECT_EQ(expected, aDirections.getNearestBeamIndices(thetas, phis));
+        }
+    }
+};
+
+TEST_F(TestBSDFDirectionsNearestIndex, SmallBasis)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam index for small basis.");
+
+    compareWithLinearSearch(BSDFHemisphere::create(BSDFBasis::Small));
+}
+
+TEST_F(TestBSDFDirectionsNearestIndex, QuarterBasis)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam index for quarter basis.");
+
+    compareWithLinearSearch(BSDFHemisphere::create(BSDFBasis::Quarter));
+}
+
+TEST_F(TestBSDFDirectionsNearestIndex, HalfBasis)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam index for half basis.");
+
+    compareWithLinearSearch(BSDFHemisphere::create(BSDFBasis::Half));
+}
+
+TEST_F(TestBSDFDirectionsNearestIndex, FullBasis)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam index for full basis.");
+
+    compareWithLinearSearch(BSDFHemisphere::create(BSDFBasis::Full));
+}
+
+TEST_F(TestBSDFDirectionsNearestIndex, CustomBasis)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam index for custom basis.");
+
+    compareWithLinearSearch(BSDFHemisphere::create({{0, 1}, {15, 6}, {40, 10}, {70, 3}}));
+}
+
+TEST_F(TestBSDFDirectionsNearestIndex, BatchSizeMismatch)
+{
+    SCOPED_TRACE("Begin Test: Nearest beam indices with different number of angles.");
+
+    const auto aHemisphere{BSDFHemisphere::create(BSDFBasis::Quarter)};
+    const auto & aDirections{aHemisphere.getDirections(BSDFDirection::Incoming)};
+
+    EXPECT_THROW(std::ignore = aDirections.getNearestBeamIndices({0, 10}, {0}),
+                 std::runtime_error);
+}
@@ -94,7 +94,7 @@ TEST_F(TestBSDFQuarterBasis, TestQuarterBasisLambdas)
     EXPECT_EQ(correctSize, aDirections.size());
 
     std::vector<double> lambdaValues;
-    std::vector<CBSDFPatch>::iterator it;
+    std::vector<CBSDFPatch>::const_iterator it;
     for(it = aDirections.begin(); it < aDirections.end(); ++it)
     {
         lambdaValues.push_back((*it).lambda());
@@ -278,3 +278,41 @@ TEST_F(TestCircularPerforatedShadeMultiWavelength, TestCircularPerforatedMultiWa
         EXPECT_NEAR(correctResults[i], calculatedResults[i], 1e-5);
     }
 }
+
+TEST_F(TestCircularPerforatedShadeMultiWavelength, FactoredResults)
+{
+    SCOPED_TRACE("Begin Test: Perforated layer (multi range) - factored BSDF results.");
+
+    std::shared_ptr<CBSDFLayer> aLayer = getLayer();
+
+    const auto aFactored{aLayer->getFactoredResults()};
+    ASSERT_TRUE(aFactored.has_value());
+
+    const auto numberOfWavelengths{aLayer->getBandWavelengths().size()};
+    EXPECT_EQ(numberOfWavelengths, aFactored->numberOfWavelengths());
+
+    const auto size{aLayer->getDirections(BSDFDirection::Incoming).size()};
+
+    for(size_t wavelengthIndex = 0u; wavelengthIndex < numberOfWavelengths; ++wavelengthIndex)
+    {
+        const auto aResults{aLayer->getResultsAtWavelength(wavelengthIndex)};
+        const auto aExpanded{aFactored->at(wavelengthIndex)};
+        for(auto aSide : EnumSide())
+        {
+            for(auto aProperty : EnumPropertySimple())
+            {
+                const auto & correct{aResults.at(aSide, aProperty)};
+                const auto & matrix{aExpanded.at(aSide, aProperty)};
+                for(size_t i = 0u; i < size; ++i)
+                {
+                    for(size_t j = 0u; j < size; ++j)
+                    {
+                        EXPECT_EQ(correct(i, j), matrix(i, j));
+                    }
+                }
+            }
+        }
+    }
+
+    EXPECT_THROW(std::ignore = aFactored->at(numberOfWavelengths), std::runtime_error);
+}
@@ -101,4 +101,48 @@ TEST_F(TestPerfectDiffuseShade1, AtWavelength)
     const auto result{aResults.DiffDiff(Side::Front, PropertySimple::R)};
 
     EXPECT_NEAR(correct, result, 1e-6);
-}
\ No newline at end of file
+}
+
+TEST_F(TestPerfectDiffuseShade1, FactoredResults)
+{
+    SCOPED_TRACE("Begin Test: Perfect diffuse shade - factored BSDF results.");
+
+    // Solar and visible properties are different so material factor changes with wavelength
+    const auto aMaterial{Material::dualBandMaterial(0.1, 0.1, 0.55, 0.5, 0.2, 0.15, 0.6, 0.65)};
+    const auto aBSDF{BSDFHemisphere::create(BSDFBasis::Quarter)};
+    const auto aShade{CBSDFLayerMaker::getPerfectlyDiffuseLayer(aMaterial, aBSDF)};
+
+    const auto aFactored{aShade->getFactoredResults()};
+    ASSERT_TRUE(aFactored.has_value());
+
+    const auto numberOfWavelengths{aShade->getBandWavelengths().size()};
+    ASSERT_GT(numberOfWavelengths, 1u);
+    EXPECT_EQ(numberOfWavelengths, aFactored->numberOfWavelengths());
+
+    const auto size{aShade->getDirections(BSDFDirection::Incoming).size()};
+    for(size_t wavelengthIndex = 0u; wavelengthIndex < numberOfWavelengths; ++wavelengthIndex)
+    {
+        const auto aResults{aShade->getResultsAtWavelength(wavelengthIndex)};
+        const auto aExpanded{aFactored->at(wavelengthIndex)};
+        for(auto aSide : EnumSide())
+        {
+            for(auto aProperty : EnumPropertySimple())
+            {
+                const auto & correct{aResults.at(aSide, aProperty)};
+                const auto & matrix{aExpanded.at(aSide, aProperty)};
+                for(size_t i = 0u; i < size; ++i)
+                {
+                    for(size_t j = 0u; j < size; ++j)
+                    {
+                        EXPECT_EQ(correct(i, j), matrix(i, j));
+                    }
+                }
+            }
+        }
+    }
+
+    // Uniform diffuse cell does not have factored properties unless it opts in
+    const auto aCell{std::make_shared<CUniformDiffuseCell>(
+      Material::singleBandMaterial(0, 0, 0.55, 0.55), std::make_shared<CFlatCellDescription>())};
+    EXPECT_FALSE(aCell->hasFactoredProperties());
+}
@@ -204,3 +204,28 @@ TEST_F(TestVenetianCellDescriptionCurvedMinus55, TestVenetian11)
 
     EXPECT_NEAR(0, Tdir_dir, 1e-6);
 }
+
+TEST_F(TestVenetianCellDescriptionCurvedMinus55, BeamTablesStore)
+{
+    SCOPED_TRACE("Begin Test: Venetian cell (Curved, -55 degrees slats) - beam tables store.");
+
+    std::shared_ptr<CVenetianCellDescription> aCell = GetCell();
+    ASSERT_NE(aCell->raysTables(), nullptr);
+
+    aCell->preCalculateForProfileAngles(Side::Front, {-30.0, 0.0, 30.0});
+    aCell->preCalculateForProfileAngles(Side::Back, {-30.0, 0.0, 30.0});
+    EXPECT_EQ(2u, aCell->raysTables()->size());
+
+    // Backward flow cell is using the store of the cell it is made from
+    const auto aBackwardCell{aCell->getBackwardFlowCell()};
+    EXPECT_EQ(aCell->raysTables(), aBackwardCell->raysTables());
+    EXPECT_EQ(4u, aCell->raysTables()->size());
+
+    // Cells created on their own have separate stores
+    const auto aOtherCell{std::make_shared<CVenetianCellDescription>(aCell->slatWidth(),
+                                                                     aCell->slatSpacing(),
+                                                                     aCell->slatTiltAngle(),
+                                                                     aCell->curvatureRadius(),
+                                                                     aCell->numOfSegments())};
+    EXPECT_NE(aCell->raysTables(), aOtherCell->raysTables());
+}
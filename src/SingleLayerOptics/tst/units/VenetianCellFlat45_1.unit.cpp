@@ -1,6 +1,8 @@
 #include <memory>
+#include <cmath>
 #include <gtest/gtest.h>
 
+#include "WCESpectralAveraging.hpp"
 #include "WCESingleLayerOptics.hpp"
 #include "WCECommon.hpp"
 
@@ -159,3 +161,150 @@ TEST_F(TestVenetianCellFlat45_1, TestVenetian4)
     EXPECT_NEAR(0.195251, Tdir_dif, 1e-6);
     EXPECT_NEAR(0.545433, Rdir_dif, 1e-6);
 }
+
+TEST_F(TestVenetianCellFlat45_1, AllDirectionsAtOnce)
+{
+    SCOPED_TRACE("Begin Test: Venetian cell (Flat, 45 degrees slats) - all directions at once.");
+
+    const auto aMaterial = Material::singleBandMaterial(0.1, 0.1, 0.7, 0.7);
+    const auto aCellDescription =
+      std::make_shared<CVenetianCellDescription>(0.010, 0.010, 45, 0, 2);
+
+    CVenetianCell aCell(aMaterial, aCellDescription);
+    CVenetianCell aBatchCell(aMaterial, aCellDescription);
+
+    const auto aBSDF{BSDFHemisphere::create(BSDFBasis::Quarter)};
+    const auto & aDirections{aBSDF.getDirections(BSDFDirection::Incoming)};
+    aBatchCell.calculateDirections(aDirections);
+
+    for(const auto aSide : EnumSide())
+    {
+        for(size_t i = 0u; i < aDirections.size(); ++i)
+        {
+            const auto aDirection{aDirections[i].centerPoint()};
+            EXPECT_NEAR(aCell.T_dir_dif(aSide, aDirection),
+                        aBatchCell.T_dir_dif(aSide, aDirection),
+                        1e-12);
+            EXPECT_NEAR(aCell.R_dir_dif(aSide, aDirection),
+                        aBatchCell.R_dir_dif(aSide, aDirection),
+                        1e-12);
+        }
+    }
+}
+
+TEST_F(TestVenetianCellFlat45_1, PiecewiseConstantMaterial)
+{
+    SCOPED_TRACE("Begin Test: Venetian cell (Flat, 45 degrees slats) - repeated band materials.");
+
+    const auto aSingleBandMaterial = Material::singleBandMaterial(0.1, 0.1, 0.7, 0.7);
+
+    const auto aMeasurements = SpectralAveraging::CSpectralSampleData::create(
+      {{0.30, 0.1, 0.7, 0.7}, {0.40, 0.1, 0.7, 0.7}, {0.50, 0.2, 0.6, 0.5}, {0.60, 0.1, 0.7, 0.7}});
+    const auto aBandMaterial =
+      Material::nBandMaterial(aMeasurements, 0.001, MaterialType::Monolithic);
+
+    const auto aCellDescription =
+      std::make_shared<CVenetianCellDescription>(0.010, 0.010, 45, 0, 2);
+
+    CVenetianCell aSingleBandCell(aSingleBandMaterial, aCellDescription);
+    CVenetianCell aBandCell(aBandMaterial, aCellDescription);
+
+    const CBeamDirection aDirection{18, 180};
+    for(const auto aSide : EnumSide())
+    {
+        const auto Tdir_dif{aSingleBandCell.T_dir_dif(aSide, aDirection)};
+        const auto Rdir_dif{aSingleBandCell.R_dir_dif(aSide, aDirection)};
+
+        const auto Tband{aBandCell.T_dir_dif_band(aSide, aDirection)};
+        const auto Rband{aBandCell.R_dir_dif_band(aSide, aDirection)};
+        ASSERT_EQ(4u, Tband.size());
+        for(const size_t index : {0u, 1u, 3u})
+        {
+            EXPECT_NEAR(Tdir_dif, Tband[index], 1e-12);
+            EXPECT_NEAR(Rdir_dif, Rband[index], 1e-12);
+        }
+        EXPECT_GT(std::abs(Tdir_dif - Tband[2]), 1e-6);
+    }
+}
+
+TEST_F(TestVenetianCellFlat45_1, AllWavelengthsAtOnce)
+{
+    SCOPED_TRACE("Begin Test: Venetian cell (Flat, 45 degrees slats) - all wavelengths at once.");
+
+    const auto aMeasurements =
+      SpectralAveraging::CSpectralSampleData::create({{0.30, 0.00, 0.05, 0.05},
+                                                      {0.40, 0.05, 0.20, 0.15},
+                                                      {0.50, 0.10, 0.60, 0.55},
+                                                      {0.60, 0.15, 0.70, 0.65},
+                                                      {0.80, 0.10, 0.65, 0.60},
+                                                      {1.00, 0.00, 0.80, 0.80}});
+    const auto aMaterial = Material::nBandMaterial(aMeasurements, 0.001, MaterialType::Monolithic);
+    const auto aCellDescription =
+      std::make_shared<CVenetianCellDescription>(0.016, 0.012, 30, 0, 5);
+
+    CVenetianCell aCell(aMaterial, aCellDescription);
+    CVenetianCell aBatchCell(aMaterial, aCellDescription);
+
+    const auto aBSDF{BSDFHemisphere::create(BSDFBasis::Quarter)};
+    const auto & aDirections{aBSDF.getDirections(BSDFDirection::Incoming)};
+    aBatchCell.calculateDirectionsAtWavelengths(aDirections);
+
+    const auto bandSize{aCell.getBandSize()};
+    ASSERT_GT(bandSize, 1u);
+    for(const auto aSide : EnumSide())
+    {
+        for(size_t i = 0u; i < aDirections.size(); ++i)
+        {
+            const auto aDirection{aDirections[i].centerPoint()};
+            for(size_t j = 0u; j < bandSize; ++j)
+            {
+                // Single direction and all directions at once are solved in the same way
+                EXPECT_EQ(aCell.T_dir_dif_at_wavelength(aSide, aDirection, j),
+                          aBatchCell.T_dir_dif_at_wavelength(aSide, aDirection, j));
+                EXPECT_EQ(aCell.R_dir_dif_at_wavelength(aSide, aDirection, j),
+                          aBatchCell.R_dir_dif_at_wavelength(aSide, aDirection, j));
+            }
+        }
+    }
+}
+
+TEST_F(TestVenetianCellFlat45_1, EnergyStatesShareGeometry)
+{
+    SCOPED_TRACE("Begin Test: Venetian cell (Flat, 45 degrees slats) - shared slat geometry.");
+
+    // First two and last two wavelengths have identical slat properties
+    const auto aMeasurements =
+      SpectralAveraging::CSpectralSampleData::create({{0.30, 0.00, 0.05, 0.05},
+                                                      {0.40, 0.00, 0.05, 0.05},
+                                                      {0.50, 0.10, 0.60, 0.55},
+                                                      {0.60, 0.15, 0.70, 0.65},
+                                                      {0.80, 0.15, 0.70, 0.65}});
+    const auto aMaterial = Material::nBandMaterial(aMeasurements, 0.001, MaterialType::Monolithic);
+    const auto aCellDescription =
+      std::make_shared<CVenetianCellDescription>(0.016, 0.012, 30, 0, 5);
+
+    CVenetianCell aCell(aMaterial, aCellDescription);
+    ASSERT_EQ(5u, aCell.getBandSize());
+
+    for(const auto aSide : EnumSide())
+    {
+        const auto & aGeometry{aCell.slatGeometry(aSide)};
+        const auto & aEnergy{aCell.energy().getCell(aSide)};
+        EXPECT_EQ(&aGeometry, &aEnergy.geometry());
+
+        // Energy states of all wavelengths borrow the geometry of the cell
+        for(size_t i = 0u; i < aCell.getBandSize(); ++i)
+        {
+            EXPECT_EQ(&aGeometry, &aCell.bandEnergy(i).getCell(aSide).geometry());
+        }
+
+        // Energy matrix is factored only once for every unique slat material
+        const auto & aFactorization{[&](const size_t wavelengthIndex) {
+            return &aCell.bandEnergy(wavelengthIndex).getCell(aSide).factorization();
+        }};
+        EXPECT_EQ(aFactorization(0u), aFactorization(1u));
+        EXPECT_EQ(aFactorization(3u), aFactorization(4u));
+        EXPECT_NE(aFactorization(1u), aFactorization(2u));
+        EXPECT_NE(aFactorization(2u), aFactorization(3u));
+    }
+}
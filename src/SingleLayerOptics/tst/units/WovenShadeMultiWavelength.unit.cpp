@@ -250,4 +250,77 @@ TEST_F(TestWovenShadeMultiWavelength, AtWavelength)
     {
         EXPECT_NEAR(correctResults[i], aT(i, i), 1e-6);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TestWovenShadeMultiWavelength, FactoredResults)
+{
+    SCOPED_TRACE("Begin Test: Woven layer does not have factored results.");
+
+    std::shared_ptr<CBSDFLayer> aLayer = getLayer();
+
+    EXPECT_FALSE(aLayer->getFactoredResults().has_value());
+}
+
+TEST_F(TestWovenShadeMultiWavelength, BandAndWavelengthResults)
+{
+    SCOPED_TRACE("Begin Test: Woven layer - band results against single wavelength results.");
+
+    std::shared_ptr<CBSDFLayer> aLayer = getLayer();
+
+    const auto aBandResults{aLayer->getWavelengthResults()};
+
+    const auto size{aLayer->getDirections(BSDFDirection::Incoming).size()};
+    for(size_t wavelengthIndex = 0u; wavelengthIndex < aBandResults.size(); ++wavelengthIndex)
+    {
+        const auto aResults{aLayer->getResultsAtWavelength(wavelengthIndex)};
+        for(auto aSide : EnumSide())
+        {
+            for(auto aProperty : EnumPropertySimple())
+            {
+                const auto & correct{aResults.at(aSide, aProperty)};
+                const auto & matrix{aBandResults[wavelengthIndex].at(aSide, aProperty)};
+                for(size_t i = 0u; i < size; ++i)
+                {
+                    for(size_t j = 0u; j < size; ++j)
+                    {
+                        EXPECT_NEAR(correct(i, j), matrix(i, j), 1e-12);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TestWovenShadeMultiWavelength, DirectionTable)
+{
+    SCOPED_TRACE("Begin Test: Woven layer - stored and calculated geometry.");
+
+    std::shared_ptr<CBSDFLayer> aLayer = getLayer();
+    const auto aCell{std::dynamic_pointer_cast<CWovenCell>(aLayer->getCell())};
+    ASSERT_TRUE(aCell != nullptr);
+
+    const auto size{aLayer->getDirections(BSDFDirection::Incoming).size()};
+    const auto bandSize{aCell->getBandSize()};
+    for(size_t wavelengthIndex = 0u; wavelengthIndex < bandSize; ++wavelengthIndex)
+    {
+        aCell->useDirectionTable(true);
+        const auto aTableResults{aLayer->getResultsAtWavelength(wavelengthIndex)};
+        aCell->useDirectionTable(false);
+        const auto aCalculatedResults{aLayer->getResultsAtWavelength(wavelengthIndex)};
+        for(auto aSide : EnumSide())
+        {
+            for(auto aProperty : EnumPropertySimple())
+            {
+                const auto & correct{aCalculatedResults.at(aSide, aProperty)};
+                const auto & matrix{aTableResults.at(aSide, aProperty)};
+                for(size_t i = 0u; i < size; ++i)
+                {
+                    for(size_t j = 0u; j < size; ++j)
+                    {
+                        EXPECT_EQ(correct(i, j), matrix(i, j));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -105,3 +105,49 @@ TEST_F(TestnBandMaterial, TestProperties)
 
     EXPECT_NEAR(value, correct, 1e-6);
 }
+
+TEST_F(TestnBandMaterial, BandPropertyAtAngle)
+{
+    const auto & mat{getMaterial()};
+
+    for(const auto theta : {0.0, 35.0, 70.0})
+    {
+        const CBeamDirection aDirection{theta, 0};
+        for(const auto aSide : EnumSide())
+        {
+            const auto bands{mat.getBandProperties(Property::R, aSide, aDirection)};
+            for(size_t i = 0u; i < bands.size(); ++i)
+            {
+                EXPECT_EQ(bands[i], mat.getBandProperty(Property::R, aSide, i, aDirection));
+            }
+        }
+    }
+}
+
+
+TEST(TestBandPropertiesCache, CalculatedOnceAndBounded)
+{
+    CBandPropertiesCache cache;
+
+    size_t numberOfCalculations{0u};
+    const auto calculator{[&]() {
+        ++numberOfCalculations;
+        return std::vector<double>{0.1, 0.2, 0.3};
+    }};
+
+    EXPECT_EQ(0.2, cache.property(Property::T, Side::Front, 10.0, 1u, calculator));
+    EXPECT_EQ(0.3, cache.property(Property::T, Side::Front, 10.0, 2u, calculator));
+    EXPECT_EQ(1u, numberOfCalculations);
+
+    // Every new angle adds one entry, but the oldest ones are removed once the limit is reached
+    for(size_t i = 0u; i < 2u * CBandPropertiesCache::maximumSize; ++i)
+    {
+        cache.properties(Property::R, Side::Back, static_cast<double>(i), calculator);
+    }
+    EXPECT_EQ(CBandPropertiesCache::maximumSize, cache.size());
+
+    // First entry is removed so it has to be calculated again
+    const auto calculations{numberOfCalculations};
+    cache.property(Property::T, Side::Front, 10.0, 0u, calculator);
+    EXPECT_EQ(calculations + 1u, numberOfCalculations);
+}
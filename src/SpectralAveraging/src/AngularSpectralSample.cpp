@@ -2,7 +2,6 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <mutex>
 
 #include "AngularSpectralSample.hpp"
 #include "MeasuredSampleData.hpp"
@@ -10,8 +9,6 @@
 #include "AngularProperties.hpp"
 #include "WCECommon.hpp"
 
-std::mutex findAngularSample;
-
 using namespace FenestrationCommon;
 
 namespace SpectralAveraging
@@ -202,7 +199,7 @@ namespace SpectralAveraging
     std::shared_ptr<CSpectralSample>
       CAngularSpectralSample::findSpectralSample(double const t_Angle)
     {
-        std::lock_guard<std::mutex> lock(findAngularSample);
+        std::lock_guard<InstanceMutex> lock(m_SampleMutex);
 
         std::shared_ptr<CSpectralSample> aSample = nullptr;
 
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <vector>
+#include <WCECommon.hpp>
 
 namespace FenestrationCommon
 {
@@ -104,6 +105,7 @@ namespace SpectralAveraging
         std::shared_ptr<CSpectralSample> m_SpectralSampleZero;   // spectral sample as zero degrees
         double m_Thickness;
         FenestrationCommon::MaterialType m_Type;
+        FenestrationCommon::InstanceMutex m_SampleMutex;
     };
 
 }   // namespace SpectralAveraging
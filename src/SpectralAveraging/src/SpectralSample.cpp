@@ -1,13 +1,10 @@
 #include <stdexcept>
 #include <cassert>
-#include <mutex>
 
 #include "SpectralSample.hpp"
 #include "MeasuredSampleData.hpp"
 #include "WCECommon.hpp"
 
-std::mutex spectralSampleMutex;
-
 using namespace FenestrationCommon;
 
 namespace SpectralAveraging
@@ -32,6 +29,8 @@ namespace SpectralAveraging
         m_StateCalculated = t_Sample.m_StateCalculated;
         m_WavelengthSet = t_Sample.m_WavelengthSet;
         m_IncomingSource = t_Sample.m_IncomingSource;
+        m_Integrator = t_Sample.m_Integrator;
+        m_NormalizationCoefficient = t_Sample.m_NormalizationCoefficient;
         for(const auto & prop : EnumProperty())
         {
             for(const auto & side : EnumSide())
@@ -102,13 +101,33 @@ namespace SpectralAveraging
         reset();
     }
 
+    FenestrationCommon::IntegrationType CSample::getIntegrator() const
+    {
+        return m_Integrator;
+    }
+
+    double CSample::getNormalizationCoeff() const
+    {
+        return m_NormalizationCoefficient;
+    }
+
+    BandIntegral CSample::bandIntegral(const double minLambda, const double maxLambda) const
+    {
+        return {m_IncomingSource.getXArray(),
+                m_Integrator,
+                m_NormalizationCoefficient,
+                minLambda,
+                maxLambda};
+    }
+
     double CSample::getEnergy(double const minLambda,
                               double const maxLambda,
                               Property const t_Property,
                               Side const t_Side)
     {
         calculateState(IntegrationType::Trapezoidal, 1);
-        return m_EnergySource.at(std::make_pair(t_Property, t_Side)).sum(minLambda, maxLambda);
+        return bandIntegral(minLambda, maxLambda)
+          .integrate(m_EnergySource.at(std::make_pair(t_Property, t_Side)).getYArray());
     }
 
     std::vector<double> CSample::getWavelengths() const
@@ -127,18 +146,20 @@ namespace SpectralAveraging
         // Otherwise just assume zero property.
         if(m_IncomingSource.size() > 0)
         {
-            auto incomingEnergy = m_IncomingSource.sum(minLambda, maxLambda);
-            double propertyEnergy =
-              m_EnergySource.at(std::make_pair(t_Property, t_Side)).sum(minLambda, maxLambda);
+            const auto aIntegral{bandIntegral(minLambda, maxLambda)};
+            const auto incomingEnergy = aIntegral.integrate(m_IncomingSource.getYArray());
+            const auto propertyEnergy =
+              aIntegral.integrate(m_EnergySource.at(std::make_pair(t_Property, t_Side)).getYArray());
             Prop = propertyEnergy / incomingEnergy;
         }
         return Prop;
     }
 
-    CSeries & CSample::getEnergyProperties(const Property t_Property, const Side t_Side)
+    CSeries CSample::getEnergyProperties(const Property t_Property, const Side t_Side)
     {
         calculateState(IntegrationType::Trapezoidal, 1);
-        return m_EnergySource.at(std::make_pair(t_Property, t_Side));
+        return m_EnergySource.at(std::make_pair(t_Property, t_Side))
+          .integrate(m_Integrator, m_NormalizationCoefficient);
     }
 
     size_t CSample::getBandSize() const
@@ -169,6 +190,9 @@ namespace SpectralAveraging
                 setWavelengths(m_WavelengthSet);
             }
 
+            m_Integrator = integrator;
+            m_NormalizationCoefficient = normalizationCoefficient;
+
             // In case source data are set then apply solar radiation to the calculations.
             // Otherwise, just use measured data.
             if(m_SourceData.size() > 0)
@@ -182,19 +206,10 @@ namespace SpectralAveraging
                     m_IncomingSource = m_IncomingSource * interpolatedDetector;
                 }
 
+                // Energies are kept wavelength by wavelength. Integration over the range is done
+                // only when property or energy is requested (see bandIntegral).
                 calculateProperties(integrator, normalizationCoefficient);
 
-                m_IncomingSource = m_IncomingSource.integrate(integrator, normalizationCoefficient);
-                for(const auto & prop : EnumProperty())
-                {
-                    for(const auto & side : EnumSide())
-                    {
-                        m_EnergySource[std::make_pair(prop, side)] =
-                          m_EnergySource.at(std::make_pair(prop, side))
-                            .integrate(integrator, normalizationCoefficient);
-                    }
-                }
-
                 m_StateCalculated = true;
             }
         }
@@ -253,7 +268,7 @@ namespace SpectralAveraging
 
     CSeries CSpectralSample::getWavelengthsProperty(const Property t_Property, const Side t_Side)
     {
-        std::lock_guard<std::mutex> lock(spectralSampleMutex);
+        std::lock_guard<InstanceMutex> lock(m_PropertyMutex);
         if(!m_StateCalculated)
         {
             calculateState(IntegrationType::Trapezoidal, 1);
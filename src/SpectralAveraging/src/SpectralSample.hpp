@@ -56,7 +56,7 @@ namespace SpectralAveraging
                            FenestrationCommon::Side const t_Side);
 
         // Spectral properties over the wavelength range
-        FenestrationCommon::CSeries &
+        FenestrationCommon::CSeries
           getEnergyProperties(FenestrationCommon::Property const t_Property,
                               FenestrationCommon::Side const t_Side);
 
@@ -87,18 +87,27 @@ namespace SpectralAveraging
         // wavelengts
         virtual std::vector<double> getWavelengthsFromSample() const = 0;
 
+        //! Integration coefficients over the wavelength range for the current state of the sample
+        [[nodiscard]] FenestrationCommon::BandIntegral bandIntegral(double minLambda,
+                                                                    double maxLambda) const;
+
         FenestrationCommon::CSeries m_SourceData;
         FenestrationCommon::CSeries m_DetectorData;
 
         std::vector<double> m_Wavelengths;
         WavelengthSet m_WavelengthSet;
 
-        // Keep energy for current state of the sample. Energy is calculated for each wavelength.
+        // Keep energy for current state of the sample. Energy is calculated for each wavelength and
+        // it is integrated only over the requested range.
         FenestrationCommon::CSeries m_IncomingSource;
         std::map<std::pair<FenestrationCommon::Property, FenestrationCommon::Side>,
                  FenestrationCommon::CSeries>
           m_EnergySource;
 
+        FenestrationCommon::IntegrationType m_Integrator{
+          FenestrationCommon::IntegrationType::Trapezoidal};
+        double m_NormalizationCoefficient{1};
+
         bool m_StateCalculated;
     };
 
@@ -142,6 +151,9 @@ namespace SpectralAveraging
         std::map<std::pair<FenestrationCommon::Property, FenestrationCommon::Side>,
                  FenestrationCommon::CSeries>
           m_Property;
+
+    private:
+        FenestrationCommon::InstanceMutex m_PropertyMutex;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,7 @@
 #include "../src/GasSpecification.hpp"
 #include "../src/BaseLayer.hpp"
 #include "../src/BaseShade.hpp"
+#include "../src/BatchSystem.hpp"
 #include "../src/DeflectionInterface.hpp"
 #include "../src/Environment.hpp"
 #include "../src/Environments.hpp"
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include <WCECommon.hpp>
+#include <WCEGases.hpp>
+
+#include "BatchSystem.hpp"
+#include "Environment.hpp"
+#include "System.hpp"
+
+namespace Tarcog::ISO15099
+{
+    namespace
+    {
+        BatchResult solveEntry(const BatchInput & t_Input)
+        {
+            // CSystem keeps its own copy of the IGU, this one is needed only for the constructor
+            auto igu{t_Input.igu};
+            CSystem aSystem(
+              igu, t_Input.indoor->cloneEnvironment(), t_Input.outdoor->cloneEnvironment());
+
+            BatchResult result;
+            result.uValue = aSystem.getUValue();
+            result.shgc = aSystem.getSHGC(t_Input.totSol);
+            for(const auto system : {System::Uvalue, System::SHGC})
+            {
+                result.temperatures[system] = aSystem.getTemperatures(system);
+                result.iterations[system] = aSystem.getNumberOfIterations(system);
+            }
+
+            return result;
+        }
+
+        //! Delivers results to the callback in the order of the inputs
+        class OrderedDelivery
+        {
+        public:
+            OrderedDelivery(std::vector<BatchResult> & t_Results, const BatchCallback & t_Callback) :
+                m_Results(t_Results),
+                m_Callback(t_Callback),
+                m_Solved(t_Results.size(), false)
+            {}
+
+            void solved(const size_t index)
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Solved[index] = true;
+                while(m_Next < m_Solved.size() && m_Solved[m_Next])
+                {
+                    if(m_Callback)
+                    {
+                        m_Callback(m_Next, m_Results[m_Next]);
+                    }
+                    ++m_Next;
+                }
+            }
+
+        private:
+            std::vector<BatchResult> & m_Results;
+            const BatchCallback & m_Callback;
+            std::vector<bool> m_Solved;
+            size_t m_Next{0u};
+            std::mutex m_Mutex;
+        };
+    }   // namespace
+
+    BatchSettings::BatchSettings() :
+        vacuumPressure(Gases::CGasSettings::instance().getVacuumPressure())
+    {}
+
+    std::vector<BatchResult> solveBatch(const std::vector<BatchInput> & t_Inputs,
+                                        const BatchSettings & t_Settings,
+                                        const BatchCallback & t_Callback)
+    {
+        for(const auto & input : t_Inputs)
+        {
+            if(input.indoor == nullptr || input.outdoor == nullptr)
+            {
+                throw std::runtime_error("Environments are not assigned to the batch entry.");
+            }
+        }
+
+        std::vector<BatchResult> results(t_Inputs.size());
+        OrderedDelivery delivery(results, t_Callback);
+
+        // Every worker takes the next unsolved entry so entries are solved (and delivered) roughly
+        // in the order of the inputs regardless of their solution time
+        std::atomic<size_t> nextEntry{0u};
+        const auto numberOfWorkers{
+          std::min(FenestrationCommon::ThreadPool::instance().numberOfThreads(), t_Inputs.size())};
+
+        FenestrationCommon::parallel_for(
+          0u, numberOfWorkers, [&](const size_t start, const size_t end) {
+              const Gases::CGasSettings::ThreadOverride gasSettings(t_Settings.vacuumPressure);
+              for(size_t worker = start; worker < end; ++worker)
+              {
+                  for(auto i = nextEntry++; i < t_Inputs.size(); i = nextEntry++)
+                  {
+                      results[i] = solveEntry(t_Inputs[i]);
+                      delivery.solved(i);
+                  }
+              }
+          });
+
+        return results;
+    }
+
+}   // namespace Tarcog::ISO15099
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <map>
+#include <functional>
+
+#include "IGU.hpp"
+#include "IGUConfigurations.hpp"
+
+namespace Tarcog::ISO15099
+{
+    class CEnvironment;
+
+    //! IGU and environments of one entry of the batch. Environments are cloned for every entry so
+    //! the same pair can be shared by the whole batch.
+    struct BatchInput
+    {
+        CIGU igu;
+        std::shared_ptr<CEnvironment> indoor;
+        std::shared_ptr<CEnvironment> outdoor;
+        //! Total solar radiation used for the SHGC calculation [W/m2]
+        double totSol{0};
+    };
+
+    struct BatchResult
+    {
+        double uValue{0};
+        double shgc{0};
+        std::map<System, std::vector<double>> temperatures;
+        std::map<System, size_t> iterations;
+    };
+
+    //! Settings that are applied to every entry of the batch only. Process-wide settings are not
+    //! changed so batches with different settings can run at the same time.
+    struct BatchSettings
+    {
+        BatchSettings();
+
+        //! Pressure bellow which gases are considered to be vacuum [Pa]
+        double vacuumPressure;
+    };
+
+    //! Called for every solved entry with its index. Calls are made in the order of the inputs,
+    //! one at the time, as soon as all the previous entries are solved.
+    using BatchCallback = std::function<void(size_t index, const BatchResult & result)>;
+
+    //! Solves independent systems on the shared thread pool (FenestrationCommon::parallel_for)
+    //! and returns results in the order of the inputs.
+    [[nodiscard]] std::vector<BatchResult> solveBatch(const std::vector<BatchInput> & t_Inputs,
+                                                      const BatchSettings & t_Settings = {},
+                                                      const BatchCallback & t_Callback = nullptr);
+
+}   // namespace Tarcog::ISO15099
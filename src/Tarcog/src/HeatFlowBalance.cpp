@@ -11,11 +11,20 @@ using FenestrationCommon::Side;
 
 namespace Tarcog::ISO15099
 {
+    namespace
+    {
+        // Cell of the solid layer reaches two elements into previous cell and two elements into
+        // the next cell
+        const size_t matrixBandwidth{5u};
+    }   // namespace
+
     CHeatFlowBalance::CHeatFlowBalance(CIGU & t_IGU) :
-        m_MatrixA(4 * t_IGU.getNumOfLayers()), m_VectorB(4 * t_IGU.getNumOfLayers()), m_IGU(t_IGU)
+        m_MatrixA(4 * t_IGU.getNumOfLayers(), matrixBandwidth, matrixBandwidth),
+        m_VectorB(4 * t_IGU.getNumOfLayers()),
+        m_IGU(t_IGU)
     {}
 
-    std::vector<double> CHeatFlowBalance::calcBalanceMatrix()
+    const std::vector<double> & CHeatFlowBalance::calcBalanceMatrix()
     {
         auto aSolidLayers = m_IGU.getSolidLayers();
         m_MatrixA.setZeros();
@@ -24,7 +33,9 @@ namespace Tarcog::ISO15099
         {
             buildCell(*aSolidLayers[i], i);
         }
-        return FenestrationCommon::CLinearSolver::solveSystem(m_MatrixA, m_VectorB);
+        m_MatrixA.factorize();
+        m_MatrixA.solve(m_VectorB);
+        return m_VectorB;
     }
 
     double getConductionConvectionCoefficient(const std::shared_ptr<CBaseLayer> & layer)
@@ -7,14 +7,6 @@
 
 #include "IGU.hpp"
 
-namespace FenestrationCommon
-{
-    class SquareMatrix;
-    class CLinearSolver;
-
-}   // namespace FenestrationCommon
-
-
 namespace Tarcog::ISO15099
 {
     class CBaseLayer;
@@ -25,7 +17,8 @@ namespace Tarcog::ISO15099
     public:
         explicit CHeatFlowBalance(CIGU & t_IGU);
 
-        std::vector<double> calcBalanceMatrix();
+        // Returned solution is valid until the next call
+        const std::vector<double> & calcBalanceMatrix();
 
     private:
         void buildBaseCell(size_t sP,
@@ -53,7 +46,9 @@ namespace Tarcog::ISO15099
                                         const Tarcog::ISO15099::CBaseLayer & solid);
         void buildCell(Tarcog::ISO15099::CBaseLayer & solid, size_t t_Index);
 
-        FenestrationCommon::SquareMatrix m_MatrixA;
+        // Every layer is coupled only with its neighbours so the matrix has only a few diagonals
+        // around the main one. It is allocated once and assembled again in every iteration.
+        FenestrationCommon::BandedMatrix m_MatrixA;
         std::vector<double> m_VectorB;
 
         CIGU & m_IGU;
@@ -486,6 +486,14 @@ namespace Tarcog::ISO15099
         }
     }
 
+    void CIGU::resetDeflectionState()
+    {
+        if(m_DeflectionFromE1300Curves.has_value())
+        {
+            resetSurfaceDeflections();
+        }
+    }
+
     void CIGU::replaceLayer(const std::shared_ptr<CBaseLayer> & t_Original,
                             const std::shared_ptr<CBaseLayer> & t_Replacement)
     {
@@ -81,6 +81,9 @@ namespace Tarcog::ISO15099
         //! Function that will update layers deflection states based on new temperature data
         void updateDeflectionState();
 
+        //! Puts panes back to non-deflected state. Deflection calculations stay enabled.
+        void resetDeflectionState();
+
         void precalculateLayerStates();
 
     private:
@@ -11,6 +11,15 @@ namespace Tarcog::ISO15099
         SHGC
     };
 
+    //! Method used to solve non-linear heat balance. FixedPoint is relaxed successive
+    //! substitution and Anderson is the same iteration accelerated with the history of previous
+    //! iterations.
+    enum class SolverMethod
+    {
+        FixedPoint,
+        Anderson
+    };
+
     class IIGUSystem
     {
     public:
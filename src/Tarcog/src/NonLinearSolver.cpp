@@ -1,6 +1,8 @@
 #include <cassert>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <deque>
 
 #include <WCECommon.hpp>
 
@@ -11,6 +13,144 @@
 
 namespace Tarcog::ISO15099
 {
+    namespace
+    {
+        //! Anderson acceleration of the fixed point iteration x = G(x). Differences of the last
+        //! few residuals f = G(x) - x and map values G(x) are kept and next state is combination
+        //! of them that minimizes linearized residual.
+        class AndersonAcceleration
+        {
+        public:
+            explicit AndersonAcceleration(const size_t t_Depth) : m_Depth(t_Depth)
+            {}
+
+            void clear()
+            {
+                m_DeltaF.clear();
+                m_DeltaG.clear();
+                m_PreviousF.clear();
+                m_PreviousG.clear();
+            }
+
+            //! Next state from the current state and the value of the map at the current state
+            [[nodiscard]] std::vector<double> nextState(const std::vector<double> & t_State,
+                                                        const std::vector<double> & t_Map,
+                                                        const double t_Relaxation)
+            {
+                const size_t size{t_State.size()};
+                std::vector<double> residual(size);
+                for(size_t i = 0; i < size; ++i)
+                {
+                    residual[i] = t_Map[i] - t_State[i];
+                }
+
+                if(!m_PreviousF.empty())
+                {
+                    m_DeltaF.push_back(difference(residual, m_PreviousF));
+                    m_DeltaG.push_back(difference(t_Map, m_PreviousG));
+                    if(m_DeltaF.size() > m_Depth)
+                    {
+                        m_DeltaF.pop_front();
+                        m_DeltaG.pop_front();
+                    }
+                }
+                m_PreviousF = residual;
+                m_PreviousG = t_Map;
+
+                const auto gamma{coefficients(residual)};
+
+                std::vector<double> result(size);
+                for(size_t i = 0; i < size; ++i)
+                {
+                    auto state{t_State[i]};
+                    auto aResidual{residual[i]};
+                    for(size_t j = 0; j < gamma.size(); ++j)
+                    {
+                        state -= gamma[j] * (m_DeltaG[j][i] - m_DeltaF[j][i]);
+                        aResidual -= gamma[j] * m_DeltaF[j][i];
+                    }
+                    result[i] = state + t_Relaxation * aResidual;
+                }
+
+                return result;
+            }
+
+        private:
+            //! Least squares solution of DeltaF * gamma = residual from normal equations
+            [[nodiscard]] std::vector<double>
+              coefficients(const std::vector<double> & t_Residual) const
+            {
+                const size_t size{m_DeltaF.size()};
+                if(size == 0u)
+                {
+                    return {};
+                }
+
+                FenestrationCommon::SquareMatrix a{size};
+                std::vector<double> b(size);
+                double trace{0};
+                for(size_t i = 0; i < size; ++i)
+                {
+                    for(size_t j = 0; j < size; ++j)
+                    {
+                        a(i, j) = dot(m_DeltaF[i], m_DeltaF[j]);
+                    }
+                    b[i] = dot(m_DeltaF[i], t_Residual);
+                    trace += a(i, i);
+                }
+
+                if(trace == 0.0)
+                {
+                    return std::vector<double>(size, 0.0);
+                }
+
+                // Differences become nearly linearly dependent close to the solution
+                for(size_t i = 0; i < size; ++i)
+                {
+                    a(i, i) += 1e-12 * trace;
+                }
+
+                return FenestrationCommon::LUFactorization(a).solve(b);
+            }
+
+            static std::vector<double> difference(const std::vector<double> & first,
+                                                  const std::vector<double> & second)
+            {
+                std::vector<double> result(first.size());
+                for(size_t i = 0; i < first.size(); ++i)
+                {
+                    result[i] = first[i] - second[i];
+                }
+                return result;
+            }
+
+            static double dot(const std::vector<double> & first,
+                              const std::vector<double> & second)
+            {
+                double result{0};
+                for(size_t i = 0; i < first.size(); ++i)
+                {
+                    result += first[i] * second[i];
+                }
+                return result;
+            }
+
+            size_t m_Depth;
+            std::deque<std::vector<double>> m_DeltaF;
+            std::deque<std::vector<double>> m_DeltaG;
+            std::vector<double> m_PreviousF;
+            std::vector<double> m_PreviousG;
+        };
+
+        //! Temperatures and radiosities must be positive
+        bool isPhysicalState(const std::vector<double> & t_State)
+        {
+            return std::all_of(t_State.begin(), t_State.end(), [](const double value) {
+                return std::isfinite(value) && value > 0;
+            });
+        }
+    }   // namespace
+
     CNonLinearSolver::CNonLinearSolver(CIGU & t_IGU, const size_t numberOfIterations) :
         m_IGU(t_IGU),
         m_QBalance(m_IGU),
@@ -50,8 +190,33 @@ namespace Tarcog::ISO15099
         return m_Iterations;
     }
 
+    size_t CNonLinearSolver::getTotalNumOfIterations() const
+    {
+        return m_TotalIterations;
+    }
+
+    double CNonLinearSolver::getSolutionTime() const
+    {
+        return m_SolutionTime;
+    }
+
+    void CNonLinearSolver::setSolverMethod(const SolverMethod t_Method)
+    {
+        m_SolverMethod = t_Method;
+    }
+
+    SolverMethod CNonLinearSolver::getSolverMethod() const
+    {
+        return m_SolverMethod;
+    }
+
     void CNonLinearSolver::solve()
     {
+        const auto startTime{std::chrono::steady_clock::now()};
+
+        AndersonAcceleration anderson{IterationConstants::ANDERSON_DEPTH};
+        auto accelerate{m_SolverMethod == SolverMethod::Anderson};
+
         m_IGUState = m_IGU.getState();
         std::vector<double> initialState(m_IGUState);
         std::vector<double> bestSolution(m_IGUState.size());
@@ -64,12 +229,30 @@ namespace Tarcog::ISO15099
         while(iterate)
         {
             ++m_Iterations;
-            std::vector<double> aSolution = m_QBalance.calcBalanceMatrix();
+            ++m_TotalIterations;
+            const auto & aSolution{m_QBalance.calcBalanceMatrix()};
 
             m_IGU.precalculateLayerStates();
             achievedTolerance = calculateTolerance(aSolution);
 
-            estimateNewState(aSolution);
+            if(accelerate)
+            {
+                auto aState{anderson.nextState(
+                  m_IGUState, aSolution, IterationConstants::ANDERSON_RELAXATION)};
+                if(isPhysicalState(aState))
+                {
+                    m_IGUState = std::move(aState);
+                }
+                else
+                {
+                    anderson.clear();
+                    estimateNewState(aSolution);
+                }
+            }
+            else
+            {
+                estimateNewState(aSolution);
+            }
 
             m_IGU.setState(m_IGUState);
 
@@ -87,6 +270,9 @@ namespace Tarcog::ISO15099
                 m_Iterations = 0;
                 m_RelaxParam -= IterationConstants::RELAXATION_PARAMETER_STEP;
 
+                // Acceleration did not help so the rest is done with plain relaxation
+                accelerate = false;
+
                 m_IGU.setState(initialState);
                 m_IGUState = initialState;
             }
@@ -99,6 +285,9 @@ namespace Tarcog::ISO15099
             }
         }
         m_IGUState = bestSolution;
+
+        m_SolutionTime =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
     }
 
     double CNonLinearSolver::solutionTolerance() const
@@ -6,6 +6,7 @@
 #include <WCECommon.hpp>
 #include "HeatFlowBalance.hpp"
 #include "IGU.hpp"
+#include "IGUConfigurations.hpp"
 
     namespace Tarcog::ISO15099
     {
@@ -20,6 +21,16 @@
             // returns number of iterations for current solution.
             [[nodiscard]] size_t getNumOfIterations() const;
 
+            // returns number of iterations of all solutions done by this solver, including
+            // restarts with smaller relaxation parameter
+            [[nodiscard]] size_t getTotalNumOfIterations() const;
+
+            // returns time spent in the last solution [s]
+            [[nodiscard]] double getSolutionTime() const;
+
+            void setSolverMethod(SolverMethod t_Method);
+            [[nodiscard]] SolverMethod getSolverMethod() const;
+
             void solve();
 
             [[nodiscard]] double solutionTolerance() const;
@@ -34,8 +45,11 @@
             std::vector<double> m_IGUState;
             double m_Tolerance;
             size_t m_Iterations;
+            size_t m_TotalIterations{0u};
             double m_RelaxParam;
             double m_SolutionTolerance;
+            SolverMethod m_SolverMethod{SolverMethod::FixedPoint};
+            double m_SolutionTime{0};
         };
 
     } // namespace Tarcog::ISO15099
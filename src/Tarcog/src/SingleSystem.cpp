@@ -82,6 +82,7 @@ namespace Tarcog::ISO15099
 
         m_NonLinearSolver =
           std::make_shared<CNonLinearSolver>(m_IGU, t_SingleSystem.getNumberOfIterations());
+        m_NonLinearSolver->setSolverMethod(t_SingleSystem.m_NonLinearSolver->getSolverMethod());
 
         return *this;
     }
@@ -207,6 +208,24 @@ namespace Tarcog::ISO15099
         return m_NonLinearSolver->getNumOfIterations();
     }
 
+    size_t CSingleSystem::getTotalNumberOfIterations() const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        return m_NonLinearSolver->getTotalNumOfIterations();
+    }
+
+    double CSingleSystem::getSolutionTime() const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        return m_NonLinearSolver->getSolutionTime();
+    }
+
+    void CSingleSystem::setSolverMethod(const SolverMethod t_Method) const
+    {
+        assert(m_NonLinearSolver != nullptr);
+        m_NonLinearSolver->setSolverMethod(t_Method);
+    }
+
     double CSingleSystem::solutionTolarance() const
     {
         assert(m_NonLinearSolver != nullptr);
@@ -225,6 +244,16 @@ namespace Tarcog::ISO15099
         m_NonLinearSolver->solve();
     }
 
+    void CSingleSystem::updateDeflectionState()
+    {
+        m_IGU.updateDeflectionState();
+    }
+
+    void CSingleSystem::resetDeflectionState()
+    {
+        m_IGU.resetDeflectionState();
+    }
+
     void CSingleSystem::initializeStartValues()
     {
         auto const startX = 0.001;
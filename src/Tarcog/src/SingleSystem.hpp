@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "IGU.hpp"
+#include "IGUConfigurations.hpp"
 
 
 namespace Tarcog::ISO15099
@@ -61,6 +62,10 @@ namespace Tarcog::ISO15099
         [[nodiscard]] double getVentilationFlow(Environment t_Environment) const;
         [[nodiscard]] double getUValue() const;
         [[nodiscard]] size_t getNumberOfIterations() const;
+        //! Iterations of all solutions of this system
+        [[nodiscard]] size_t getTotalNumberOfIterations() const;
+        //! Time spent in the last solution [s]
+        [[nodiscard]] double getSolutionTime() const;
         [[nodiscard]] double solutionTolarance() const;
         [[nodiscard]] bool isToleranceAchieved() const;
 
@@ -68,6 +73,8 @@ namespace Tarcog::ISO15099
 
         // Set solution tolerance
         void setTolerance(double t_Tolerance) const;
+        // Set method used to solve non-linear heat balance
+        void setSolverMethod(SolverMethod t_Method) const;
         // Set intial guess for solution.
         void setInitialGuess(const std::vector<double> & t_Temperatures) const;
 
@@ -92,11 +99,21 @@ namespace Tarcog::ISO15099
 
         void clearDeflection();
 
+        //! Sets linear temperature profile between indoor and outdoor as the starting point of
+        //! the next solution. Otherwise solution starts from the current state of the system.
+        void initializeStartValues();
+
+        //! Updates deflected gap widths from the current temperatures. Solution that starts from
+        //! the current state needs it when geometry or load changed after the last solution.
+        void updateDeflectionState();
+
+        //! Puts panes back to non-deflected state so the next solution starts from it
+        void resetDeflectionState();
+
     private:
         CIGU m_IGU;
         std::map<Environment, std::shared_ptr<CEnvironment>> m_Environment;
         std::shared_ptr<CNonLinearSolver> m_NonLinearSolver;
-        void initializeStartValues();
     };
 
 }   // namespace Tarcog::ISO15099
@@ -1,3 +1,5 @@
+#include <WCECommon.hpp>
+
 #include "System.hpp"
 #include "IGU.hpp"
 #include "Environment.hpp"
@@ -8,7 +10,9 @@ namespace Tarcog::ISO15099
 {
     CSystem::CSystem(CIGU & t_IGU,
                      std::shared_ptr<CEnvironment> const & t_Indoor,
-                     std::shared_ptr<CEnvironment> const & t_Outdoor)
+                     std::shared_ptr<CEnvironment> const & t_Outdoor,
+                     const bool t_SolveConcurrently) :
+        m_SolveConcurrently(t_SolveConcurrently)
     {
         m_System[System::SHGC] = std::make_shared<CSingleSystem>(t_IGU, t_Indoor, t_Outdoor);
         m_System[System::Uvalue] = std::make_shared<CSingleSystem>(
@@ -122,6 +126,22 @@ namespace Tarcog::ISO15099
         return m_System.at(t_System)->getNumberOfIterations();
     }
 
+    double CSystem::getSolutionTime(System const t_System)
+    {
+        checkSolved();
+        return m_System.at(t_System)->getSolutionTime();
+    }
+
+    void CSystem::setSolverMethod(const SolverMethod t_Method)
+    {
+        for(auto & [key, system] : m_System)
+        {
+            std::ignore = key;
+            system->setSolverMethod(t_Method);
+        }
+        m_Solved = false;
+    }
+
     std::vector<double> CSystem::getSolidEffectiveLayerConductivities(const System t_System)
     {
         checkSolved();
@@ -206,16 +226,141 @@ namespace Tarcog::ISO15099
         m_Solved = false;
     }
 
+    std::vector<SweepResult> CSystem::sweep(const std::vector<SweepPoint> & t_Points,
+                                            const double t_TotSol,
+                                            const SweepStart t_Start)
+    {
+        std::vector<SweepResult> results;
+        results.reserve(t_Points.size());
+        for(const auto & point : t_Points)
+        {
+            std::map<System, size_t> startIterations;
+            for(auto & [key, system] : m_System)
+            {
+                if(t_Start == SweepStart::Cold)
+                {
+                    system->resetDeflectionState();
+                    system->initializeStartValues();
+                }
+                startIterations[key] = system->getTotalNumberOfIterations();
+            }
+
+            if(point.width.has_value())
+            {
+                setWidth(point.width.value());
+            }
+            if(point.height.has_value())
+            {
+                setHeight(point.height.value());
+            }
+            if(point.tilt.has_value())
+            {
+                setTilt(point.tilt.value());
+            }
+            if(point.appliedLoad.has_value())
+            {
+                setAppliedLoad(point.appliedLoad.value());
+            }
+            if(point.initialGuess.has_value())
+            {
+                for(auto & [key, system] : m_System)
+                {
+                    std::ignore = key;
+                    system->setInitialGuess(point.initialGuess.value());
+                }
+            }
+            if(t_Start == SweepStart::Warm)
+            {
+                // Previous solution is the starting point so gap widths need to follow the new
+                // geometry and load before the first iteration
+                for(auto & [key, system] : m_System)
+                {
+                    std::ignore = key;
+                    system->updateDeflectionState();
+                }
+            }
+
+            // Setting absorptances solves SHGC system at once so it goes after all changes that
+            // are affecting the solution
+            if(point.absorptances.has_value())
+            {
+                setAbsorptances(point.absorptances.value());
+            }
+
+            std::vector<System> unsolved;
+            for(const auto & [key, system] : m_System)
+            {
+                std::ignore = system;
+                if(key != System::SHGC || !point.absorptances.has_value())
+                {
+                    unsolved.push_back(key);
+                }
+            }
+            solve(unsolved);
+            m_Solved = true;
+
+            SweepResult result;
+            result.uValue = getUValue();
+            result.shgc = getSHGC(t_TotSol);
+            for(auto & [key, system] : m_System)
+            {
+                result.temperatures[key] = system->getTemperatures();
+                result.meanGapWidths[key] = system->getMeanGapWidth();
+                result.iterations[key] =
+                  system->getTotalNumberOfIterations() - startIterations.at(key);
+            }
+            results.push_back(result);
+        }
+
+        return results;
+    }
+
+    void CSystem::setSolveConcurrently(const bool t_SolveConcurrently)
+    {
+        m_SolveConcurrently = t_SolveConcurrently;
+    }
+
     void CSystem::solve()
     {
-        for(auto & [key, system] : m_System)
+        std::vector<System> systems;
+        for(const auto & [key, system] : m_System)
         {
-            std::ignore = key;
-            system->solve();
+            std::ignore = system;
+            systems.push_back(key);
         }
+        solve(systems);
         m_Solved = true;
     }
 
+    void CSystem::solve(const std::vector<System> & t_Systems)
+    {
+        std::vector<std::shared_ptr<CSingleSystem>> systems;
+        for(const auto key : t_Systems)
+        {
+            systems.push_back(m_System.at(key));
+        }
+
+        if(m_SolveConcurrently)
+        {
+            // Systems do not share any data (IGU and environments are cloned) so each one can be
+            // solved on its own thread
+            FenestrationCommon::parallel_for(
+              0u, systems.size(), [&systems](const size_t start, const size_t end) {
+                  for(size_t i = start; i < end; ++i)
+                  {
+                      systems[i]->solve();
+                  }
+              });
+        }
+        else
+        {
+            for(const auto & system : systems)
+            {
+                system->solve();
+            }
+        }
+    }
+
     void CSystem::checkSolved()
     {
         if(!m_Solved)
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <optional>
 #include "IGUConfigurations.hpp"
 
 namespace Tarcog
@@ -19,13 +20,49 @@ namespace Tarcog
 
         class CIGUSolidLayer;
 
+        //! Parameters of one point of the parametric sweep. Only parameters that are set are
+        //! changed, the rest stays the same as in the previous point.
+        struct SweepPoint
+        {
+            std::optional<double> width;
+            std::optional<double> height;
+            std::optional<double> tilt;
+            std::optional<std::vector<double>> appliedLoad;
+            std::optional<std::vector<double>> absorptances;
+            //! Surface temperatures used as the starting point instead of the previous solution
+            std::optional<std::vector<double>> initialGuess;
+        };
+
+        struct SweepResult
+        {
+            double uValue{0};
+            double shgc{0};
+            std::map<System, std::vector<double>> temperatures;
+            std::map<System, std::vector<double>> meanGapWidths;
+            //! Number of iterations needed to solve the point
+            std::map<System, size_t> iterations;
+        };
+
+        enum class SweepStart
+        {
+            //! Every point starts from the solution of the previous point (temperatures,
+            //! radiosities and deflection state)
+            Warm,
+            //! Every point starts from the linear temperature profile and non-deflected panes
+            Cold
+        };
+
         class CSystem : public IIGUSystem
         {
         public:
             virtual ~CSystem() = default;
+            //! U-value and SHGC systems are independent and they can be solved concurrently on
+            //! the shared thread pool (FenestrationCommon::parallel_for). Results are identical to
+            //! the ones from the serial solution.
             CSystem(CIGU & t_IGU,
                     const std::shared_ptr<CEnvironment> & t_Indoor,
-                    const std::shared_ptr<CEnvironment> & t_Outdoor);
+                    const std::shared_ptr<CEnvironment> & t_Outdoor,
+                    bool t_SolveConcurrently = false);
 
             [[nodiscard]] std::vector<double> getTemperatures(System t_System);
             [[nodiscard]] std::vector<double> getRadiosities(System t_System);
@@ -54,6 +91,11 @@ namespace Tarcog
             [[nodiscard]] double getSHGC(double t_TotSol) override;
             [[nodiscard]] double getH(System sys, Environment environment) const override;
             [[nodiscard]] size_t getNumberOfIterations(System t_System);
+            //! Time spent in the last solution of the given system [s]
+            [[nodiscard]] double getSolutionTime(System t_System);
+
+            void setSolverMethod(SolverMethod t_Method);
+            void setSolveConcurrently(bool t_SolveConcurrently);
 
             [[nodiscard]] double relativeHeatGain(double Tsol);
 
@@ -69,13 +111,21 @@ namespace Tarcog
             void setDeflectionProperties(const std::vector<double> & measuredGapWidths);
             void clearDeflection();
 
+            //! Solves points in the given order and returns results for every point
+            [[nodiscard]] std::vector<SweepResult>
+              sweep(const std::vector<SweepPoint> & t_Points,
+                    double t_TotSol,
+                    SweepStart t_Start = SweepStart::Warm);
+
         private:
             void solve();
+            void solve(const std::vector<System> & t_Systems);
             void checkSolved();
 
             std::map<System, std::shared_ptr<CSingleSystem>> m_System;
 
             bool m_Solved{false};
+            bool m_SolveConcurrently{false};
         };
 
     }   // namespace ISO15099
@@ -25,6 +25,10 @@ namespace Tarcog
         const double RELAXATION_PARAMETER_AIRFLOW_MIN = 0.1;
         const double RELAXATION_PARAMETER_AIRFLOW_STEP = 0.1;
         const double CONVERGENCE_TOLERANCE_AIRFLOW = 1e-6;
+        // Number of previous iterations used by Anderson acceleration
+        const size_t ANDERSON_DEPTH = 3;
+        // Accelerated step is already a combination of previous iterations and it is not relaxed
+        const double ANDERSON_RELAXATION = 1.0;
     }   // namespace IterationConstants
 
     namespace MaterialConstants
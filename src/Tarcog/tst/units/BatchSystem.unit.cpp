@@ -0,0 +1,124 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "WCEGases.hpp"
+#include "WCECommon.hpp"
+
+using Tarcog::ISO15099::System;
+
+class TestBatchSystem : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        FenestrationCommon::ThreadPool::instance().setNumberOfThreads(2u);
+
+        m_Outdoor = Tarcog::ISO15099::Environments::outdoor(
+          305.15, 2.75, 783.0, 305.15, Tarcog::ISO15099::SkyModel::AllSpecified);
+        m_Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        m_Indoor = Tarcog::ISO15099::Environments::indoor(297.15);
+    }
+
+    void TearDown() override
+    {
+        FenestrationCommon::ThreadPool::instance().setNumberOfThreads(0u);
+    }
+
+    //! Double glazing with low-e coating. Gap pressure bellow default vacuum pressure will create
+    //! vacuum glazing.
+    [[nodiscard]] Tarcog::ISO15099::BatchInput input(const double gapThickness,
+                                                     const double gapPressure) const
+    {
+        auto layer1 = Tarcog::ISO15099::Layers::solid(0.003048, 1.0, 0.84, 0.0, 0.038798, 0.0);
+        layer1->setSolarHeatGain(0.194422, 783.0);
+        auto layer2 = Tarcog::ISO15099::Layers::solid(0.005715, 1.0, 0.84, 0.0, 0.84, 0.0);
+        layer2->setSolarHeatGain(0.066659, 783.0);
+
+        auto gap = Tarcog::ISO15099::Layers::gap(gapThickness, gapPressure);
+
+        Tarcog::ISO15099::CIGU aIGU(1.0, 1.0);
+        aIGU.addLayers({layer1, gap, layer2});
+
+        return {aIGU, m_Indoor, m_Outdoor, 783.0};
+    }
+
+    [[nodiscard]] std::vector<Tarcog::ISO15099::BatchInput> inputs() const
+    {
+        return {input(0.0127, 101325),
+                input(0.0001, 0.1333),
+                input(0.006, 101325),
+                input(0.02, 101325),
+                input(0.0002, 0.1333)};
+    }
+
+    std::shared_ptr<Tarcog::ISO15099::CEnvironment> m_Outdoor;
+    std::shared_ptr<Tarcog::ISO15099::CEnvironment> m_Indoor;
+};
+
+TEST_F(TestBatchSystem, SameAsSerialSolution)
+{
+    SCOPED_TRACE("Begin Test: Batch of IGUs compared to the systems solved one by one.");
+
+    const auto aInputs{inputs()};
+
+    std::vector<size_t> delivered;
+    const auto results{Tarcog::ISO15099::solveBatch(
+      aInputs, {}, [&delivered](const size_t index, const Tarcog::ISO15099::BatchResult &) {
+          delivered.push_back(index);
+      })};
+
+    ASSERT_EQ(aInputs.size(), results.size());
+    ASSERT_EQ(aInputs.size(), delivered.size());
+
+    for(size_t i = 0u; i < aInputs.size(); ++i)
+    {
+        EXPECT_EQ(i, delivered[i]);
+
+        auto aIGU{aInputs[i].igu};
+        Tarcog::ISO15099::CSystem aSystem(aIGU,
+                                          aInputs[i].indoor->cloneEnvironment(),
+                                          aInputs[i].outdoor->cloneEnvironment());
+
+        EXPECT_EQ(aSystem.getUValue(), results[i].uValue);
+        EXPECT_EQ(aSystem.getSHGC(aInputs[i].totSol), results[i].shgc);
+        for(const auto system : {System::Uvalue, System::SHGC})
+        {
+            EXPECT_EQ(aSystem.getTemperatures(system), results[i].temperatures.at(system));
+            EXPECT_EQ(aSystem.getNumberOfIterations(system), results[i].iterations.at(system));
+        }
+    }
+}
+
+TEST_F(TestBatchSystem, BatchVacuumPressure)
+{
+    SCOPED_TRACE("Begin Test: Vacuum pressure applied to the batch only.");
+
+    const auto & gasSettings{Gases::CGasSettings::instance()};
+    const auto defaultPressure{gasSettings.getVacuumPressure()};
+
+    // Vacuum gaps will be calculated as regular gas gaps
+    Tarcog::ISO15099::BatchSettings settings;
+    settings.vacuumPressure = 0.01;
+
+    const auto aInputs{inputs()};
+    const auto defaultResults{Tarcog::ISO15099::solveBatch(aInputs)};
+    const auto results{Tarcog::ISO15099::solveBatch(aInputs, settings)};
+
+    EXPECT_EQ(defaultPressure, Gases::CGasSettings::instance().getVacuumPressure());
+
+    ASSERT_EQ(defaultResults.size(), results.size());
+    for(size_t i = 0u; i < aInputs.size(); ++i)
+    {
+        const bool isVacuum{aInputs[i].igu.getGapLayers()[0]->getPressure() < defaultPressure};
+        if(isVacuum)
+        {
+            EXPECT_GT(std::abs(defaultResults[i].uValue - results[i].uValue), 1e-3);
+        }
+        else
+        {
+            EXPECT_EQ(defaultResults[i].uValue, results[i].uValue);
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "WCECommon.hpp"
+
+class DoubleLowEVacuumNoPillarAnderson : public testing::Test
+{
+private:
+    std::shared_ptr<Tarcog::ISO15099::CSingleSystem> m_FixedPointSystem;
+    std::shared_ptr<Tarcog::ISO15099::CSingleSystem> m_AndersonSystem;
+
+protected:
+    void SetUp() override
+    {
+        /////////////////////////////////////////////////////////
+        /// Outdoor
+        /////////////////////////////////////////////////////////
+        auto airTemperature = 255.15;   // Kelvins
+        auto airSpeed = 5.5;            // meters per second
+        auto tSky = 255.15;             // Kelvins
+        auto solarRadiation = 0.0;
+
+        auto Outdoor = Tarcog::ISO15099::Environments::outdoor(
+          airTemperature, airSpeed, solarRadiation, tSky, Tarcog::ISO15099::SkyModel::AllSpecified);
+        ASSERT_TRUE(Outdoor != nullptr);
+        Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        /////////////////////////////////////////////////////////
+        /// Indoor
+        /////////////////////////////////////////////////////////
+
+        auto roomTemperature = 294.15;
+
+        auto Indoor = Tarcog::ISO15099::Environments::indoor(roomTemperature);
+        ASSERT_TRUE(Indoor != nullptr);
+
+        /////////////////////////////////////////////////////////
+        /// IGU
+        /////////////////////////////////////////////////////////
+        auto solidLayerThickness = 0.004;   // [m]
+        auto solidLayerConductance = 1.0;
+        auto TransmittanceIR = 0.0;
+        auto emissivityFrontIR = 0.84;
+        auto emissivityBackIR = 0.036749500781;
+
+        auto layer1 = Tarcog::ISO15099::Layers::solid(solidLayerThickness,
+                                                      solidLayerConductance,
+                                                      emissivityFrontIR,
+                                                      TransmittanceIR,
+                                                      emissivityBackIR,
+                                                      TransmittanceIR);
+
+        solidLayerThickness = 0.003962399904;
+        emissivityBackIR = 0.84;
+
+        auto layer2 = Tarcog::ISO15099::Layers::solid(solidLayerThickness,
+                                                      solidLayerConductance,
+                                                      emissivityFrontIR,
+                                                      TransmittanceIR,
+                                                      emissivityBackIR,
+                                                      TransmittanceIR);
+
+        auto gapThickness = 0.0001;
+        auto gapPressure = 0.1333;
+        auto m_GapLayer = Tarcog::ISO15099::Layers::gap(gapThickness, gapPressure);
+        ASSERT_TRUE(m_GapLayer != nullptr);
+
+        auto windowWidth = 1.0;   //[m]
+        auto windowHeight = 1.0;
+        Tarcog::ISO15099::CIGU aIGU(windowWidth, windowHeight);
+        aIGU.addLayers({layer1, m_GapLayer, layer2});
+
+        // Alternative way of adding layers.
+        // aIGU.addLayer(layer1);
+        // aIGU.addLayer(m_GapLayer);
+        // aIGU.addLayer(layer2);
+
+        /////////////////////////////////////////////////////////
+        /// System
+        /////////////////////////////////////////////////////////
+        const auto andersonIndoor{Indoor->cloneEnvironment()};
+        const auto andersonOutdoor{Outdoor->cloneEnvironment()};
+
+        m_FixedPointSystem =
+          std::make_shared<Tarcog::ISO15099::CSingleSystem>(aIGU, Indoor, Outdoor);
+        ASSERT_TRUE(m_FixedPointSystem != nullptr);
+        m_FixedPointSystem->solve();
+
+        m_AndersonSystem =
+          std::make_shared<Tarcog::ISO15099::CSingleSystem>(aIGU, andersonIndoor, andersonOutdoor);
+        ASSERT_TRUE(m_AndersonSystem != nullptr);
+        m_AndersonSystem->setSolverMethod(Tarcog::ISO15099::SolverMethod::Anderson);
+        m_AndersonSystem->solve();
+    }
+
+public:
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSingleSystem> GetFixedPointSystem() const
+    {
+        return m_FixedPointSystem;
+    }
+
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSingleSystem> GetAndersonSystem() const
+    {
+        return m_AndersonSystem;
+    }
+};
+
+TEST_F(DoubleLowEVacuumNoPillarAnderson, Test1)
+{
+    SCOPED_TRACE("Begin Test: Double Low-E - vacuum with no pillar support (Anderson solver)");
+
+    constexpr auto Tolerance = 1e-6;
+
+    auto aSystem = GetAndersonSystem();
+
+    ASSERT_TRUE(aSystem != nullptr);
+
+    const auto Temperature = aSystem->getTemperatures();
+    const std::vector correctTemperature{255.501938, 255.543003, 292.514948, 292.555627};
+    ASSERT_EQ(correctTemperature.size(), Temperature.size());
+
+    for(auto i = 0u; i < correctTemperature.size(); ++i)
+    {
+        EXPECT_NEAR(correctTemperature[i], Temperature[i], Tolerance);
+    }
+
+    const auto Radiosity = aSystem->getRadiosities();
+    std::vector correctRadiosity{241.409657, 407.569595, 413.894817, 416.791085};
+    ASSERT_EQ(correctRadiosity.size(), Radiosity.size());
+
+    for(auto i = 0u; i < correctRadiosity.size(); ++i)
+    {
+        EXPECT_NEAR(correctRadiosity[i], Radiosity[i], Tolerance);
+    }
+
+    EXPECT_TRUE(aSystem->isToleranceAchieved());
+}
+
+TEST_F(DoubleLowEVacuumNoPillarAnderson, IterationsComparedToFixedPoint)
+{
+    SCOPED_TRACE("Begin Test: Double Low-E - vacuum - Anderson and fixed point iterations");
+
+    auto aFixedPointSystem = GetFixedPointSystem();
+    auto aAndersonSystem = GetAndersonSystem();
+
+    const auto fixedPointIterations{aFixedPointSystem->getNumberOfIterations()};
+    const auto andersonIterations{aAndersonSystem->getNumberOfIterations()};
+
+    EXPECT_EQ(37u, fixedPointIterations);
+    EXPECT_LT(3 * andersonIterations, fixedPointIterations);
+
+    EXPECT_GE(aAndersonSystem->getSolutionTime(), 0.0);
+}
@@ -0,0 +1,139 @@
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "WCECommon.hpp"
+
+// U-value and SHGC systems solved concurrently must give the same results as the serial solution
+class TestDoubleLoweConcurrentSystem : public testing::Test
+{
+private:
+    std::shared_ptr<Tarcog::ISO15099::CSystem> m_SerialSystem;
+    std::shared_ptr<Tarcog::ISO15099::CSystem> m_ConcurrentSystem;
+
+protected:
+    void SetUp() override
+    {
+        FenestrationCommon::ThreadPool::instance().setNumberOfThreads(2u);
+
+        /////////////////////////////////////////////////////////
+        /// Outdoor
+        /////////////////////////////////////////////////////////
+        const auto airTemperature{255.15};   // Kelvins
+        const auto airSpeed{5.5};            // meters per second
+        const auto tSky{255.15};             // Kelvins
+        const auto solarRadiation{783.0};
+
+        auto Outdoor = Tarcog::ISO15099::Environments::outdoor(
+          airTemperature, airSpeed, solarRadiation, tSky, Tarcog::ISO15099::SkyModel::AllSpecified);
+        ASSERT_TRUE(Outdoor != nullptr);
+        Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        /////////////////////////////////////////////////////////
+        /// Indoor
+        /////////////////////////////////////////////////////////
+
+        const auto roomTemperature{294.15};
+        const auto Indoor = Tarcog::ISO15099::Environments::indoor(roomTemperature);
+        ASSERT_TRUE(Indoor != nullptr);
+
+        /////////////////////////////////////////////////////////
+        // IGU
+        /////////////////////////////////////////////////////////
+        const auto solidLayerThickness1{0.00318};   // [m]
+        const auto solidLayerConductance1{1.0};
+        const auto tIR1{0.0};
+        const auto frontEmissivity1{0.84};
+        const auto backEmissivity1{0.046578168869};
+
+        const auto layer1 = Tarcog::ISO15099::Layers::solid(solidLayerThickness1,
+                                                            solidLayerConductance1,
+                                                            frontEmissivity1,
+                                                            tIR1,
+                                                            backEmissivity1,
+                                                            tIR1);
+        ASSERT_TRUE(layer1 != nullptr);
+
+        const auto gapThickness{0.0127};
+        auto gap{Tarcog::ISO15099::Layers::gap(gapThickness)};
+
+        const auto solidLayerThickness2{0.005715};   // [m]
+        const auto solidLayerConductance2{1.0};
+
+        const auto layer2 =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness2, solidLayerConductance2);
+
+        const auto iguWidth{1.0};
+        const auto iguHeight{1.0};
+        Tarcog::ISO15099::CIGU aIGU(iguWidth, iguHeight);
+        aIGU.addLayers({layer1, gap, layer2});
+
+        /////////////////////////////////////////////////////////
+        /// System
+        /////////////////////////////////////////////////////////
+        const auto concurrentIndoor{Indoor->cloneEnvironment()};
+        const auto concurrentOutdoor{Outdoor->cloneEnvironment()};
+
+        m_SerialSystem = std::make_shared<Tarcog::ISO15099::CSystem>(aIGU, Indoor, Outdoor);
+        ASSERT_TRUE(m_SerialSystem != nullptr);
+
+        m_ConcurrentSystem = std::make_shared<Tarcog::ISO15099::CSystem>(
+          aIGU, concurrentIndoor, concurrentOutdoor, true);
+        ASSERT_TRUE(m_ConcurrentSystem != nullptr);
+
+        // Changing absorptances will force both systems to be solved again
+        const std::vector<double> absorptances{0.12, 0.07};
+        m_SerialSystem->setAbsorptances(absorptances);
+        m_ConcurrentSystem->setAbsorptances(absorptances);
+    }
+
+    void TearDown() override
+    {
+        FenestrationCommon::ThreadPool::instance().setNumberOfThreads(0u);
+    }
+
+public:
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSystem> GetSerialSystem() const
+    {
+        return m_SerialSystem;
+    };
+
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSystem> GetConcurrentSystem() const
+    {
+        return m_ConcurrentSystem;
+    };
+};
+
+TEST_F(TestDoubleLoweConcurrentSystem, Test1)
+{
+    SCOPED_TRACE("Begin Test: Double Low-E - U-value and SHGC systems solved concurrently");
+
+    auto aSerialSystem = GetSerialSystem();
+    auto aConcurrentSystem = GetConcurrentSystem();
+
+    for(const auto aRun : {Tarcog::ISO15099::System::Uvalue, Tarcog::ISO15099::System::SHGC})
+    {
+        const auto correctTemperature = aSerialSystem->getTemperatures(aRun);
+        const auto Temperature = aConcurrentSystem->getTemperatures(aRun);
+        ASSERT_EQ(correctTemperature.size(), Temperature.size());
+        for(auto i = 0u; i < correctTemperature.size(); ++i)
+        {
+            EXPECT_EQ(correctTemperature[i], Temperature[i]);
+        }
+
+        const auto correctRadiosity = aSerialSystem->getRadiosities(aRun);
+        const auto Radiosity = aConcurrentSystem->getRadiosities(aRun);
+        ASSERT_EQ(correctRadiosity.size(), Radiosity.size());
+        for(auto i = 0u; i < correctRadiosity.size(); ++i)
+        {
+            EXPECT_EQ(correctRadiosity[i], Radiosity[i]);
+        }
+
+        EXPECT_EQ(aSerialSystem->getNumberOfIterations(aRun),
+                  aConcurrentSystem->getNumberOfIterations(aRun));
+    }
+
+    EXPECT_EQ(aSerialSystem->getUValue(), aConcurrentSystem->getUValue());
+    EXPECT_EQ(aSerialSystem->getSHGC(0.3716), aConcurrentSystem->getSHGC(0.3716));
+}
@@ -0,0 +1,139 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "vectorTesting.hpp"
+
+// Double low-e window with deflection solved with fixed point and Anderson accelerated iterations
+class TestDoubleLoweWithDeflectionAnderson : public testing::Test
+{
+private:
+    std::shared_ptr<Tarcog::ISO15099::CSingleSystem> m_FixedPointSystem;
+    std::shared_ptr<Tarcog::ISO15099::CSingleSystem> m_AndersonSystem;
+
+protected:
+    void SetUp() override
+    {
+        /////////////////////////////////////////////////////////
+        /// Outdoor
+        /////////////////////////////////////////////////////////
+        const auto airTemperature{255.15};   // Kelvins
+        const auto airSpeed{5.5};            // meters per second
+        const auto tSky{255.15};             // Kelvins
+        const auto solarRadiation{783.0};
+
+        auto Outdoor = Tarcog::ISO15099::Environments::outdoor(
+          airTemperature, airSpeed, solarRadiation, tSky, Tarcog::ISO15099::SkyModel::AllSpecified);
+        ASSERT_TRUE(Outdoor != nullptr);
+        Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        /////////////////////////////////////////////////////////
+        /// Indoor
+        /////////////////////////////////////////////////////////
+
+        const auto roomTemperature{294.15};
+
+        const auto Indoor = Tarcog::ISO15099::Environments::indoor(roomTemperature);
+        ASSERT_TRUE(Indoor != nullptr);
+
+        /////////////////////////////////////////////////////////
+        // IGU
+        /////////////////////////////////////////////////////////
+        const auto solidLayerThickness1{0.00318};   // [m]
+        const auto solidLayerConductance1{1.0};
+        const auto tIR1{0.0};
+        const auto frontEmissivity1{0.84};
+        const auto backEmissivity1{0.046578168869};
+
+        const auto layer1 = Tarcog::ISO15099::Layers::solid(solidLayerThickness1,
+                                                            solidLayerConductance1,
+                                                            frontEmissivity1,
+                                                            tIR1,
+                                                            backEmissivity1,
+                                                            tIR1);
+        layer1->setSolarHeatGain(0.194422408938, solarRadiation);
+        ASSERT_TRUE(layer1 != nullptr);
+
+        const auto gapThickness{0.0127};
+        auto gap{Tarcog::ISO15099::Layers::gap(gapThickness)};
+
+        const auto solidLayerThickness2{0.005715};   // [m]
+        const auto solidLayerConductance2{1.0};
+        const auto layer2 =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness2, solidLayerConductance2);
+        layer2->setSolarHeatGain(0.054760526866, solarRadiation);
+
+        const auto iguWidth{1.0};
+        const auto iguHeight{1.0};
+        Tarcog::ISO15099::CIGU aIGU(iguWidth, iguHeight);
+        aIGU.addLayers({layer1, gap, layer2});
+
+        const double initialTemperature{293.15};
+        const double initialPressure{101325};
+        aIGU.setDeflectionProperties(initialTemperature, initialPressure);
+
+        /////////////////////////////////////////////////////////
+        /// System
+        /////////////////////////////////////////////////////////
+        const auto andersonIndoor{Indoor->cloneEnvironment()};
+        const auto andersonOutdoor{Outdoor->cloneEnvironment()};
+
+        m_FixedPointSystem =
+          std::make_shared<Tarcog::ISO15099::CSingleSystem>(aIGU, Indoor, Outdoor);
+        ASSERT_TRUE(m_FixedPointSystem != nullptr);
+        m_FixedPointSystem->solve();
+
+        m_AndersonSystem =
+          std::make_shared<Tarcog::ISO15099::CSingleSystem>(aIGU, andersonIndoor, andersonOutdoor);
+        ASSERT_TRUE(m_AndersonSystem != nullptr);
+        m_AndersonSystem->setSolverMethod(Tarcog::ISO15099::SolverMethod::Anderson);
+        m_AndersonSystem->solve();
+    }
+
+public:
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSingleSystem> GetFixedPointSystem() const
+    {
+        return m_FixedPointSystem;
+    }
+
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSingleSystem> GetAndersonSystem() const
+    {
+        return m_AndersonSystem;
+    }
+};
+
+TEST_F(TestDoubleLoweWithDeflectionAnderson, Results)
+{
+    SCOPED_TRACE("Begin Test: Double Low-e with deflection - Anderson and fixed point results");
+
+    // Both methods stop once the iteration tolerance is reached so they agree only to that level
+    constexpr auto Tolerance = 1e-3;
+    constexpr auto DeflectionTolerance = 1e-7;
+
+    const auto aFixedPointSystem = GetFixedPointSystem();
+    const auto aAndersonSystem = GetAndersonSystem();
+
+    testVectors("Temperatures",
+                aFixedPointSystem->getTemperatures(),
+                aAndersonSystem->getTemperatures(),
+                Tolerance);
+
+    testVectors("Max deflection",
+                aFixedPointSystem->getMaxLayerDeflections(),
+                aAndersonSystem->getMaxLayerDeflections(),
+                DeflectionTolerance);
+
+    EXPECT_TRUE(aAndersonSystem->isToleranceAchieved());
+}
+
+TEST_F(TestDoubleLoweWithDeflectionAnderson, IterationsComparedToFixedPoint)
+{
+    SCOPED_TRACE("Begin Test: Double Low-e with deflection - Anderson and fixed point iterations");
+
+    const auto fixedPointIterations{GetFixedPointSystem()->getNumberOfIterations()};
+    const auto andersonIterations{GetAndersonSystem()->getNumberOfIterations()};
+
+    EXPECT_EQ(26u, fixedPointIterations);
+    EXPECT_EQ(12u, andersonIterations);
+    EXPECT_LT(2 * andersonIterations, fixedPointIterations);
+}
@@ -0,0 +1,163 @@
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+#include "vectorTesting.hpp"
+
+using Tarcog::ISO15099::CSingleSystem;
+
+// Forced ventilated gap between glass and interior shade solved with fixed point and Anderson
+// accelerated iterations
+class TestForcedVentilationInsideAirAnderson : public testing::Test
+{
+private:
+    std::unique_ptr<CSingleSystem> m_FixedPointSystem;
+    std::unique_ptr<CSingleSystem> m_AndersonSystem;
+
+protected:
+    void SetUp() override
+    {
+        /////////////////////////////////////////////////////////
+        // Outdoor
+        /////////////////////////////////////////////////////////
+
+        auto outdoorAirTemperature = 298.15;   // Kelvins
+        auto outdoorAirSpeed = 2.75;           // meters per second
+        auto tSky = outdoorAirTemperature;     // Kelvins
+        auto solarRadiation = 1000.0;
+        auto Outdoor =
+          Tarcog::ISO15099::Environments::outdoor(outdoorAirTemperature,
+                                                  outdoorAirSpeed,
+                                                  solarRadiation,
+                                                  tSky,
+                                                  Tarcog::ISO15099::SkyModel::AllSpecified);
+        ASSERT_TRUE(Outdoor != nullptr);
+        Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        /////////////////////////////////////////////////////////
+        /// Indoor
+        /////////////////////////////////////////////////////////
+
+        auto roomTemperature = 298.15;
+        auto Indoor = Tarcog::ISO15099::Environments::indoor(roomTemperature);
+        ASSERT_TRUE(Indoor != nullptr);
+
+        /////////////////////////////////////////////////////////
+        /// IGU
+        /////////////////////////////////////////////////////////
+
+        auto windowWidth = 1.0;
+        auto windowHeight = 1.0;
+
+        const auto solidLayerThickness = 0.003048;   // [m]
+        const auto solidLayerConductance = 1.0;
+        auto solidLayer =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness, solidLayerConductance);
+        solidLayer->setSolarHeatGain(0.04, solarRadiation);
+        ASSERT_TRUE(solidLayer != nullptr);
+
+        auto gapThickness = 0.05;
+        auto gapLayer = Tarcog::ISO15099::Layers::gap(gapThickness);
+        ASSERT_TRUE(gapLayer != nullptr);
+        auto gapAirSpeed = 0.1;
+        auto forcedGapLayer =
+          Tarcog::ISO15099::Layers::forcedVentilationGap(gapLayer, gapAirSpeed, roomTemperature);
+        ASSERT_TRUE(forcedGapLayer != nullptr);
+
+        auto shadeLayerConductance = 0.12;
+        // make cell geometry
+        const auto thickness_31111{0.00023};
+        const auto x = 0.00169;        // m
+        const auto y = 0.00169;        // m
+        const auto radius = 0.00058;   // m
+        const auto CellDimension{
+          ThermalPermeability::Perforated::diameterToXYDimension(2 * radius)};
+        const auto frontOpenness{ThermalPermeability::Perforated::openness(
+          ThermalPermeability::Perforated::Geometry::Circular,
+          x,
+          y,
+          CellDimension.x,
+          CellDimension.y)};
+        const auto dl{0.0};
+        const auto dr{0.0};
+        const auto dtop{0.0};
+        const auto dbot{0.0};
+        EffectiveLayers::ShadeOpenness openness{frontOpenness, dl, dr, dtop, dbot};
+        EffectiveLayers::EffectiveLayerPerforated effectiveLayerPerforated{
+          windowWidth, windowHeight, thickness_31111, openness};
+        EffectiveLayers::EffectiveOpenness effOpenness{
+          effectiveLayerPerforated.getEffectiveOpenness()};
+        const auto effectiveThickness{effectiveLayerPerforated.effectiveThickness()};
+        auto Ef = 0.640892;
+        auto Eb = 0.623812;
+        auto Tirf = 0.257367;
+        auto Tirb = 0.257367;
+        auto shadeLayer = Tarcog::ISO15099::Layers::shading(
+          effectiveThickness, shadeLayerConductance, effOpenness, Ef, Tirf, Eb, Tirb);
+        shadeLayer->setSolarHeatGain(0.35, solarRadiation);
+        ASSERT_TRUE(shadeLayer != nullptr);
+
+        Tarcog::ISO15099::CIGU aIGU(windowWidth, windowHeight);
+        aIGU.addLayers({solidLayer, forcedGapLayer, shadeLayer});
+
+        /////////////////////////////////////////////////////////
+        /// System
+        /////////////////////////////////////////////////////////
+        const auto andersonIndoor{Indoor->cloneEnvironment()};
+        const auto andersonOutdoor{Outdoor->cloneEnvironment()};
+
+        m_FixedPointSystem = std::make_unique<CSingleSystem>(aIGU, Indoor, Outdoor);
+        ASSERT_TRUE(m_FixedPointSystem != nullptr);
+        m_FixedPointSystem->solve();
+
+        m_AndersonSystem = std::make_unique<CSingleSystem>(aIGU, andersonIndoor, andersonOutdoor);
+        ASSERT_TRUE(m_AndersonSystem != nullptr);
+        m_AndersonSystem->setSolverMethod(Tarcog::ISO15099::SolverMethod::Anderson);
+        m_AndersonSystem->solve();
+    }
+
+public:
+    [[nodiscard]] CSingleSystem & GetFixedPointSystem() const
+    {
+        return *m_FixedPointSystem;
+    }
+
+    [[nodiscard]] CSingleSystem & GetAndersonSystem() const
+    {
+        return *m_AndersonSystem;
+    }
+};
+
+TEST_F(TestForcedVentilationInsideAirAnderson, Results)
+{
+    SCOPED_TRACE("Begin Test: Forced ventilated gap - Anderson and fixed point results");
+
+    // Airflow iterations are set to 1e-4 and it cannot exceed that precision
+    constexpr auto Tolerance = 1e-3;
+
+    auto & aFixedPointSystem = GetFixedPointSystem();
+    auto & aAndersonSystem = GetAndersonSystem();
+
+    testVectors("Temperatures",
+                aFixedPointSystem.getTemperatures(),
+                aAndersonSystem.getTemperatures(),
+                Tolerance);
+
+    EXPECT_NEAR(aFixedPointSystem.getGapLayers()[0]->getGainFlow(),
+                aAndersonSystem.getGapLayers()[0]->getGainFlow(),
+                Tolerance);
+
+    EXPECT_TRUE(aAndersonSystem.isToleranceAchieved());
+}
+
+TEST_F(TestForcedVentilationInsideAirAnderson, IterationsComparedToFixedPoint)
+{
+    SCOPED_TRACE("Begin Test: Forced ventilated gap - Anderson and fixed point iterations");
+
+    const auto fixedPointIterations{GetFixedPointSystem().getNumberOfIterations()};
+    const auto andersonIterations{GetAndersonSystem().getNumberOfIterations()};
+
+    EXPECT_EQ(28u, fixedPointIterations);
+    EXPECT_EQ(20u, andersonIterations);
+    EXPECT_LT(andersonIterations, fixedPointIterations);
+}
@@ -0,0 +1,180 @@
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "WCETarcog.hpp"
+
+// Parametric sweep of triple clear window with deflection. Every point of the warm sweep starts
+// from the previous solution and results must be the same as the ones started from the linear
+// temperature profile.
+class TestTripleClearDeflectionSweep : public testing::Test
+{
+private:
+    std::shared_ptr<Tarcog::ISO15099::CSystem> m_WarmSystem;
+    std::shared_ptr<Tarcog::ISO15099::CSystem> m_ColdSystem;
+
+protected:
+    void SetUp() override
+    {
+        /////////////////////////////////////////////////////////
+        /// Outdoor
+        /////////////////////////////////////////////////////////
+        constexpr auto airTemperature{250};      // Kelvins
+        constexpr auto airSpeed{5.5};            // meters per second
+        constexpr auto tSky{255.15};             // Kelvins
+        constexpr auto solarRadiation{0.0};
+
+        auto Outdoor = Tarcog::ISO15099::Environments::outdoor(
+          airTemperature, airSpeed, solarRadiation, tSky, Tarcog::ISO15099::SkyModel::AllSpecified);
+        ASSERT_TRUE(Outdoor != nullptr);
+        Outdoor->setHCoeffModel(Tarcog::ISO15099::BoundaryConditionsCoeffModel::CalculateH);
+
+        /////////////////////////////////////////////////////////
+        /// Indoor
+        /////////////////////////////////////////////////////////
+
+        constexpr auto roomTemperature{293.0};
+
+        auto Indoor = Tarcog::ISO15099::Environments::indoor(roomTemperature);
+        ASSERT_TRUE(Indoor != nullptr);
+
+        /////////////////////////////////////////////////////////
+        /// IGU
+        /////////////////////////////////////////////////////////
+        constexpr auto solidLayerThickness{0.003048}; // [m]
+        constexpr auto solidLayerConductance{1.0};    // [W/m2K]
+
+        auto aSolidLayer1 =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness, solidLayerConductance);
+        aSolidLayer1->setSolarHeatGain(0.099839858711, solarRadiation);
+
+        auto aSolidLayer2 =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness, solidLayerConductance);
+        aSolidLayer2->setSolarHeatGain(0.076627746224, solarRadiation);
+
+        auto aSolidLayer3 =
+          Tarcog::ISO15099::Layers::solid(solidLayerThickness, solidLayerConductance);
+        aSolidLayer3->setSolarHeatGain(0.058234799653, solarRadiation);
+
+        constexpr auto gapThickness1{0.006};
+        const auto gapLayer1 = Tarcog::ISO15099::Layers::gap(gapThickness1);
+        ASSERT_TRUE(gapLayer1 != nullptr);
+
+        constexpr auto gapThickness2{0.025};
+        const auto gapLayer2 = Tarcog::ISO15099::Layers::gap(gapThickness2);
+        ASSERT_TRUE(gapLayer2 != nullptr);
+
+        constexpr auto windowWidth{1.0};
+        constexpr auto windowHeight{1.0};
+        Tarcog::ISO15099::CIGU aIGU(windowWidth, windowHeight);
+        aIGU.addLayers({aSolidLayer1, gapLayer1, aSolidLayer2, gapLayer2, aSolidLayer3});
+
+        /////////////////////////////////////////////////////////
+        /// System
+        /////////////////////////////////////////////////////////
+        const auto coldIndoor{Indoor->cloneEnvironment()};
+        const auto coldOutdoor{Outdoor->cloneEnvironment()};
+
+        m_WarmSystem = std::make_shared<Tarcog::ISO15099::CSystem>(aIGU, Indoor, Outdoor);
+        ASSERT_TRUE(m_WarmSystem != nullptr);
+        m_WarmSystem->setDeflectionProperties(273, 101325);
+
+        m_ColdSystem = std::make_shared<Tarcog::ISO15099::CSystem>(aIGU, coldIndoor, coldOutdoor);
+        ASSERT_TRUE(m_ColdSystem != nullptr);
+        m_ColdSystem->setDeflectionProperties(273, 101325);
+    }
+
+public:
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSystem> GetWarmSystem() const
+    {
+        return m_WarmSystem;
+    }
+
+    [[nodiscard]] std::shared_ptr<Tarcog::ISO15099::CSystem> GetColdSystem() const
+    {
+        return m_ColdSystem;
+    }
+
+    [[nodiscard]] static std::vector<Tarcog::ISO15099::SweepPoint> sweepPoints()
+    {
+        std::vector<Tarcog::ISO15099::SweepPoint> points;
+        for(const auto size : {1.0, 1.05, 1.1, 1.15, 1.2, 1.25})
+        {
+            Tarcog::ISO15099::SweepPoint point;
+            point.width = size;
+            point.height = size;
+            points.push_back(point);
+        }
+
+        Tarcog::ISO15099::SweepPoint loadPoint;
+        loadPoint.appliedLoad = std::vector<double>{0, 0, 1000};
+        points.push_back(loadPoint);
+
+        Tarcog::ISO15099::SweepPoint tiltPoint;
+        tiltPoint.tilt = 80;
+        points.push_back(tiltPoint);
+
+        return points;
+    }
+};
+
+TEST_F(TestTripleClearDeflectionSweep, WarmAndColdStart)
+{
+    SCOPED_TRACE("Begin Test: Triple Clear with deflection - warm and cold parametric sweep");
+
+    constexpr auto Tolerance = 1e-5;
+
+    const auto points{sweepPoints()};
+    const auto warm{GetWarmSystem()->sweep(points, 0.0, Tarcog::ISO15099::SweepStart::Warm)};
+    const auto cold{GetColdSystem()->sweep(points, 0.0, Tarcog::ISO15099::SweepStart::Cold)};
+
+    ASSERT_EQ(points.size(), warm.size());
+    ASSERT_EQ(points.size(), cold.size());
+
+    size_t warmIterations{0u};
+    size_t coldIterations{0u};
+    for(size_t i = 0u; i < points.size(); ++i)
+    {
+        EXPECT_NEAR(cold[i].uValue, warm[i].uValue, Tolerance);
+
+        const auto aRun{Tarcog::ISO15099::System::Uvalue};
+        const auto & coldTemperatures{cold[i].temperatures.at(aRun)};
+        const auto & warmTemperatures{warm[i].temperatures.at(aRun)};
+        ASSERT_EQ(coldTemperatures.size(), warmTemperatures.size());
+        for(size_t j = 0u; j < coldTemperatures.size(); ++j)
+        {
+            EXPECT_NEAR(coldTemperatures[j], warmTemperatures[j], Tolerance);
+        }
+
+        const auto & coldGaps{cold[i].meanGapWidths.at(aRun)};
+        const auto & warmGaps{warm[i].meanGapWidths.at(aRun)};
+        ASSERT_EQ(coldGaps.size(), warmGaps.size());
+        for(size_t j = 0u; j < coldGaps.size(); ++j)
+        {
+            EXPECT_NEAR(coldGaps[j], warmGaps[j], 1e-8);
+        }
+
+        warmIterations += warm[i].iterations.at(aRun);
+        coldIterations += cold[i].iterations.at(aRun);
+    }
+
+    EXPECT_LT(warmIterations, coldIterations);
+}
+
+TEST_F(TestTripleClearDeflectionSweep, AbsorptancesSolvedOnce)
+{
+    SCOPED_TRACE("Begin Test: Triple Clear with deflection - SHGC system is solved once per point");
+
+    Tarcog::ISO15099::SweepPoint point;
+    point.width = 1.1;
+    point.absorptances = std::vector<double>{0.1, 0.08, 0.06};
+
+    auto aSystem{GetWarmSystem()};
+    const auto warm{aSystem->sweep({point}, 0.0, Tarcog::ISO15099::SweepStart::Warm)};
+    ASSERT_EQ(1u, warm.size());
+
+    for(const auto aRun : {Tarcog::ISO15099::System::Uvalue, Tarcog::ISO15099::System::SHGC})
+    {
+        EXPECT_EQ(aSystem->getNumberOfIterations(aRun), warm[0].iterations.at(aRun));
+    }
+}
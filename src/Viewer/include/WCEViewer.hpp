@@ -4,5 +4,6 @@
 #include "../src/Geometry2DBeam.hpp"
 #include "../src/Point2D.hpp"
 #include "../src/Segment2D.hpp"
+#include "../src/SegmentBVH2D.hpp"
 #include "../src/ViewerConstants.hpp"
 #include "../src/ViewSegment2D.hpp"
\ No newline at end of file
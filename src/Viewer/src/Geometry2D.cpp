@@ -1,4 +1,5 @@
 #include <cassert>
+#include <array>
 
 #include "Geometry2D.hpp"
 #include "ViewSegment2D.hpp"
@@ -10,6 +11,13 @@ using namespace FenestrationCommon;
 
 namespace Viewer
 {
+    namespace
+    {
+        // Intersection points and points inside of the view are checked with the tolerance so
+        // segments within this distance from the searched area still need to be tested
+        const double searchDistance{2 * ViewerConstants::DISTANCE_TOLERANCE};
+    }   // namespace
+
     CGeometry2D::CGeometry2D() : m_ViewFactorsCalculated(false)
     {}
 
@@ -92,102 +100,77 @@ namespace Viewer
                                           CPoint2D const & t_Point)
     {
         // Forming polygon
-        std::vector<CViewSegment2D> aPolygon;
-        aPolygon.push_back(t_Segment1);
-        auto point1 = t_Segment1.endPoint();
-        auto point2 = t_Segment2.startPoint();
-        auto aSide2 = CViewSegment2D(point1, point2);
+        std::array<CViewSegment2D, 4> aPolygon;
+        size_t polygonSize{0u};
+        aPolygon[polygonSize++] = t_Segment1;
+        const CViewSegment2D aSide2{t_Segment1.endPoint(), t_Segment2.startPoint()};
         if(aSide2.length() > 0)
         {
-            aPolygon.push_back(aSide2);
+            aPolygon[polygonSize++] = aSide2;
         }
-        aPolygon.push_back(t_Segment2);
-        auto point3 = t_Segment2.endPoint();
-        auto point4 = t_Segment1.startPoint();
-        auto aSide4 = CViewSegment2D(point3, point4);
+        aPolygon[polygonSize++] = t_Segment2;
+        const CViewSegment2D aSide4{t_Segment2.endPoint(), t_Segment1.startPoint()};
         if(aSide4.length() > 0)
         {
-            aPolygon.push_back(aSide4);
+            aPolygon[polygonSize++] = aSide4;
         }
 
         // now check if point is in the polygon. Note that if point is of any edge of the polygon,
         // it will not be considered to be part of blocking surface. Otherwise, program would search
         // for blocking surfaces and perform double integration over the both surfaces.
-        auto inSide = true;
-        for(auto aSegment : aPolygon)
+        for(size_t i = 0u; i < polygonSize; ++i)
         {
-            inSide = inSide && (aSegment.position(t_Point) == PointPosition::Visible);
-            if(!inSide)
+            if(aPolygon[i].position(t_Point) != PointPosition::Visible)
             {
-                break;
+                return false;
             }
         }
 
-        return inSide;
+        return true;
     }
 
     bool CGeometry2D::thirdSurfaceShadowing(CViewSegment2D const & t_Segment1,
                                             CViewSegment2D const & t_Segment2) const
     {
-        auto intersection = false;
-
         // Form cross segments
-        std::vector<std::shared_ptr<CViewSegment2D>> intSegments;
-        auto r11 = std::make_shared<CViewSegment2D>(t_Segment1.startPoint(), t_Segment2.endPoint());
-        if(r11->length() > 0)
+        const CViewSegment2D r11{t_Segment1.startPoint(), t_Segment2.endPoint()};
+        const CViewSegment2D r22{t_Segment1.endPoint(), t_Segment2.startPoint()};
+        const auto checkR11{r11.length() > 0};
+        const auto checkR22{r22.length() > 0};
+        if(!checkR11 && !checkR22)
         {
-            intSegments.push_back(r11);
-        }
-        auto r22 = std::make_shared<CViewSegment2D>(t_Segment1.endPoint(), t_Segment2.startPoint());
-        if(r22->length() > 0)
-        {
-            intSegments.push_back(r22);
+            return false;
         }
 
-        for(auto aSegment : m_Segments)
-        {
-            for(auto iSegment : intSegments)
+        // Both cross segments and the polygon between two segments are inside the box of the two
+        // segments so blocking segment must overlap it
+        const auto searchArea{
+          BoundingBox2D(t_Segment1).merge(BoundingBox2D(t_Segment2)).expand(searchDistance)};
+
+        return m_SegmentsTree.anyOf(searchArea, [&](const size_t index) {
+            const auto & aSegment{m_Segments[index]};
+            if(aSegment == t_Segment1 || aSegment == t_Segment2)
             {
-                if(aSegment != t_Segment1 && aSegment != t_Segment2)
-                {
-                    intersection = intersection || iSegment->intersectionWithSegment(aSegment);
-                    intersection =
-                      intersection
-                      || pointInSegmentsView(t_Segment1, t_Segment2, aSegment.startPoint());
-                    intersection =
-                      intersection
-                      || pointInSegmentsView(t_Segment1, t_Segment2, aSegment.endPoint());
-                    if(intersection)
-                    {
-                        return intersection;
-                    }
-                }
+                return false;
             }
-        }
-
-        return intersection;
+            return (checkR11 && r11.intersectionWithSegment(aSegment))
+                   || (checkR22 && r22.intersectionWithSegment(aSegment))
+                   || pointInSegmentsView(t_Segment1, t_Segment2, aSegment.startPoint())
+                   || pointInSegmentsView(t_Segment1, t_Segment2, aSegment.endPoint());
+        });
     }
 
     bool CGeometry2D::thirdSurfaceShadowingSimple(const CViewSegment2D & t_Segment1,
                                                   const CViewSegment2D & t_Segment2) const
     {
-        auto intersection = false;
-
-        CViewSegment2D centerLine{t_Segment1.centerPoint(), t_Segment2.centerPoint()};
-
-        for(auto aSegment : m_Segments)
-        {
-            if(aSegment != t_Segment1 && aSegment != t_Segment2)
-            {
-                intersection = intersection || centerLine.intersectionWithSegment(aSegment);
-                if(intersection)
-                {
-                    break;
-                }
-            }
-        }
-
-        return intersection;
+        const CViewSegment2D centerLine{t_Segment1.centerPoint(), t_Segment2.centerPoint()};
+
+        return m_SegmentsTree.anyOf(
+          BoundingBox2D(centerLine).expand(searchDistance), [&](const size_t index) {
+              const auto & aSegment{m_Segments[index]};
+              return aSegment != t_Segment1 && aSegment != t_Segment2
+                     && centerLine.intersectionWithSegment(aSegment);
+          });
     }
 
     double CGeometry2D::viewFactorCoeff(const CViewSegment2D & t_Segment1,
@@ -241,36 +224,54 @@ namespace Viewer
         {
             auto size = m_Segments.size();
 
-            // View factor matrix. It is already initialized to zeros
-            m_ViewFactors = SquareMatrix(size);
+            std::vector<BoundingBox2D> boxes;
+            boxes.reserve(size);
+            for(const auto & aSegment : m_Segments)
+            {
+                boxes.emplace_back(aSegment);
+            }
+            m_SegmentsTree = CSegmentBVH2D(boxes);
+
+            std::vector<std::pair<size_t, size_t>> pairs;
+            pairs.reserve(size * size / 2);
             for(auto i = 0u; i < size; ++i)
             {
-                for(auto j = i; j < size; ++j)
+                for(auto j = i + 1; j < size; ++j)
+                {
+                    pairs.emplace_back(i, j);
+                }
+            }
+
+            // View factor matrix. It is already initialized to zeros
+            m_ViewFactors = SquareMatrix(size);
+
+            // Every pair writes to its own elements of the matrix so pairs can be calculated
+            // concurrently
+            parallel_for(0u, pairs.size(), [this, &pairs](const size_t start, const size_t end) {
+                for(auto k = start; k < end; ++k)
                 {
-                    if(i != j)
+                    const auto [i, j] = pairs[k];
+                    auto selfShadowing = m_Segments[i].selfShadowing(m_Segments[j]);
+                    if(selfShadowing != Shadowing::Total)
                     {
-                        auto selfShadowing = m_Segments[i].selfShadowing(m_Segments[j]);
-                        if(selfShadowing != Shadowing::Total)
+                        auto shadowedByThirdSurface =
+                          thirdSurfaceShadowing(m_Segments[i], m_Segments[j]);
+                        auto vfCoeff = 0.0;
+
+                        if(!shadowedByThirdSurface && (selfShadowing == Shadowing::No))
+                        {
+                            vfCoeff = m_Segments[i].viewFactorCoefficient(m_Segments[j]);
+                        }
+                        else if(shadowedByThirdSurface || selfShadowing == Shadowing::Partial)
                         {
-                            auto shadowedByThirdSurface =
-                              thirdSurfaceShadowing(m_Segments[i], m_Segments[j]);
-                            auto vfCoeff = 0.0;
-
-                            if(!shadowedByThirdSurface && (selfShadowing == Shadowing::No))
-                            {
-                                vfCoeff = m_Segments[i].viewFactorCoefficient(m_Segments[j]);
-                            }
-                            else if(shadowedByThirdSurface || selfShadowing == Shadowing::Partial)
-                            {
-                                vfCoeff = viewFactorCoeff(m_Segments[i], m_Segments[j]);
-                            }
-
-                            m_ViewFactors(i, j) = vfCoeff / (2 * m_Segments[i].length());
-                            m_ViewFactors(j, i) = vfCoeff / (2 * m_Segments[j].length());
+                            vfCoeff = viewFactorCoeff(m_Segments[i], m_Segments[j]);
                         }
+
+                        m_ViewFactors(i, j) = vfCoeff / (2 * m_Segments[i].length());
+                        m_ViewFactors(j, i) = vfCoeff / (2 * m_Segments[j].length());
                     }
                 }
-            }
+            });
 
             m_ViewFactorsCalculated = true;
         }
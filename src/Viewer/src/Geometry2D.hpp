@@ -6,6 +6,8 @@
 
 #include <WCECommon.hpp>
 
+#include "SegmentBVH2D.hpp"
+
 namespace Viewer
 {
     class CViewSegment2D;
@@ -66,6 +68,9 @@ namespace Viewer
 
         std::vector<CViewSegment2D> m_Segments;
 
+        // Used to find segments that could block the view between two segments
+        CSegmentBVH2D m_SegmentsTree;
+
         // Holds state for the view factors. No need to recalculate them every time since it is
         // time consuming operation.
         FenestrationCommon::SquareMatrix m_ViewFactors;
@@ -14,6 +14,29 @@ using namespace FenestrationCommon;
 
 namespace Viewer
 {
+    namespace
+    {
+        // Results of the ray calculations depend only on the side, segments coordinates and
+        // profile angles
+        std::vector<double> geometryKey(Side const t_Side,
+                                        const std::vector<CGeometry2D> & t_Geometries)
+        {
+            std::vector<double> result{static_cast<double>(t_Side)};
+            for(const auto & geometry : t_Geometries)
+            {
+                result.push_back(static_cast<double>(geometry.segments().size()));
+                for(const auto & segment : geometry.segments())
+                {
+                    result.push_back(segment.startPoint().x());
+                    result.push_back(segment.startPoint().y());
+                    result.push_back(segment.endPoint().x());
+                    result.push_back(segment.endPoint().y());
+                }
+            }
+            return result;
+        }
+    }   // namespace
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // BeamViewFactor
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -162,47 +185,132 @@ namespace Viewer
         return m_ProfileAngle;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysTable
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    CDirect2DRaysTable::CDirect2DRaysTable(std::vector<long long> t_Keys,
+                                           std::vector<CDirect2DRaysResult> t_Results) :
+        m_Keys(std::move(t_Keys)),
+        m_Results(std::move(t_Results))
+    {
+        assert(m_Keys.size() == m_Results.size());
+    }
+
+    std::optional<size_t> CDirect2DRaysTable::index(double const t_ProfileAngle) const
+    {
+        const auto key{keyFromProfileAngle(t_ProfileAngle)};
+        const auto it{std::lower_bound(m_Keys.begin(), m_Keys.end(), key)};
+        if(it == m_Keys.end() || *it != key)
+        {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(std::distance(m_Keys.begin(), it));
+    }
+
+    const CDirect2DRaysResult & CDirect2DRaysTable::result(size_t const t_Index) const
+    {
+        return m_Results.at(t_Index);
+    }
+
+    size_t CDirect2DRaysTable::size() const
+    {
+        return m_Results.size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysTables
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const CDirect2DRaysTable>
+      CDirect2DRaysTables::find(const CDirect2DRaysTables::Key & t_Key) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const auto it{m_Tables.find(t_Key)};
+        return it != m_Tables.end() ? it->second.lock() : nullptr;
+    }
+
+    std::shared_ptr<const CDirect2DRaysTable>
+      CDirect2DRaysTables::store(const CDirect2DRaysTables::Key & t_Key,
+                                 std::shared_ptr<const CDirect2DRaysTable> t_Table)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for(auto it = m_Tables.begin(); it != m_Tables.end();)
+        {
+            it = it->second.expired() ? m_Tables.erase(it) : std::next(it);
+        }
+        auto & stored{m_Tables[t_Key]};
+        if(auto existing = stored.lock())
+        {
+            return existing;
+        }
+        stored = t_Table;
+        return t_Table;
+    }
+
+    size_t CDirect2DRaysTables::size() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return static_cast<size_t>(
+          std::count_if(m_Tables.begin(), m_Tables.end(), [](const auto & table) {
+              return !table.second.expired();
+          }));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // CDirect2DRays
     ////////////////////////////////////////////////////////////////////////////////////////
 
-    CDirect2DRays::CDirect2DRays(Side const t_Side) : m_Side(t_Side)
+    CDirect2DRays::CDirect2DRays(Side const t_Side,
+                                 std::shared_ptr<CDirect2DRaysTables> t_Tables) :
+        m_Side(t_Side),
+        m_Tables(std::move(t_Tables))
     {}
 
     void CDirect2DRays::appendGeometry2D(const CGeometry2D & t_Geometry2D)
     {
         m_Geometries2D.push_back(t_Geometry2D);
+        m_PrecalculatedResults = nullptr;
     }
 
     std::vector<BeamViewFactor> CDirect2DRays::beamViewFactors(double const t_ProfileAngle)
     {
-        checkForProfileAngle(t_ProfileAngle);
-        return m_RayResults.at(keyFromProfileAngle(t_ProfileAngle)).beamViewFactors();
+        return result(t_ProfileAngle).beamViewFactors();
     }
 
     double CDirect2DRays::directToDirect(double const t_ProfileAngle)
     {
-        checkForProfileAngle(t_ProfileAngle);
-        return m_RayResults.at(keyFromProfileAngle(t_ProfileAngle)).directToDirect();
+        return result(t_ProfileAngle).directToDirect();
     }
 
-    void CDirect2DRays::checkForProfileAngle(const double t_ProfileAngle)
-    {   // Need to have this in case the profile angle is not precalculated
-        if(!m_RayResults.count(keyFromProfileAngle(t_ProfileAngle)))
+    const CDirect2DRaysResult & CDirect2DRays::result(const double t_ProfileAngle)
+    {
+        if(m_PrecalculatedResults != nullptr)
         {
-            m_RayResults[keyFromProfileAngle(t_ProfileAngle)] =
-              calculateAllProperties(t_ProfileAngle);
+            if(const auto index = m_PrecalculatedResults->index(t_ProfileAngle))
+            {
+                return m_PrecalculatedResults->result(index.value());
+            }
+        }
+
+        // Need to have this in case the profile angle is not precalculated
+        const auto key{keyFromProfileAngle(t_ProfileAngle)};
+        auto it{m_RayResults.find(key)};
+        if(it == m_RayResults.end())
+        {
+            it = m_RayResults.emplace(key, calculateAllProperties(t_ProfileAngle)).first;
         }
+        return it->second;
     }
 
-    CDirect2DRaysResult CDirect2DRays::calculateAllProperties(double const t_ProfileAngle)
+    CDirect2DRaysResult CDirect2DRays::calculateAllProperties(double const t_ProfileAngle) const
     {
         auto boundaries{findRayBoundaries(t_ProfileAngle)};
         auto rays{findInBetweenRays(t_ProfileAngle, boundaries)};
         return calculateBeamProperties(t_ProfileAngle, rays);
     }
 
-    CDirect2DRays::RayBoundaries CDirect2DRays::findRayBoundaries(double const t_ProfileAngle)
+    CDirect2DRays::RayBoundaries CDirect2DRays::findRayBoundaries(double const t_ProfileAngle) const
     {
         RayBoundaries result;
 
@@ -237,7 +345,7 @@ namespace Viewer
     }
 
     std::vector<CDirect2DRay> CDirect2DRays::findInBetweenRays(double const t_ProfileAngle,
-                                                               RayBoundaries & boudnaries)
+                                                               RayBoundaries & boudnaries) const
     {
         std::vector<CPoint2D> inBetweenPoints;
 
@@ -285,8 +393,9 @@ namespace Viewer
         return rays;
     }
 
-    CDirect2DRaysResult CDirect2DRays::calculateBeamProperties(double const t_ProfileAngle,
-                                                               std::vector<CDirect2DRay> & rays)
+    CDirect2DRaysResult
+      CDirect2DRays::calculateBeamProperties(double const t_ProfileAngle,
+                                             std::vector<CDirect2DRay> & rays) const
     {
         // First check all segments and calculte total ray height
         auto totalHeight = 0.0;
@@ -376,18 +485,69 @@ namespace Viewer
 
     void CDirect2DRays::precalculateForProfileAngles(const std::vector<double> & t_ProfileAngles)
     {
+        // Table is sorted by keys so angles that are rounding to the same key are calculated once
+        std::map<long long, double> anglesByKey;
         for(const auto & angle : t_ProfileAngles)
         {
-            m_RayResults[keyFromProfileAngle(angle)] = calculateAllProperties(angle);
+            anglesByKey.emplace(keyFromProfileAngle(angle), angle);
         }
+
+        std::vector<long long> keys;
+        std::vector<double> angles;
+        keys.reserve(anglesByKey.size());
+        angles.reserve(anglesByKey.size());
+        for(const auto & [key, angle] : anglesByKey)
+        {
+            keys.push_back(key);
+            angles.push_back(angle);
+        }
+
+        // Results that are already calculated are kept for lookups
+        if(m_PrecalculatedResults != nullptr)
+        {
+            for(size_t i = 0u; i < m_PrecalculatedResults->size(); ++i)
+            {
+                const auto & aResult{m_PrecalculatedResults->result(i)};
+                m_RayResults.emplace(keyFromProfileAngle(aResult.profileAngle()), aResult);
+            }
+        }
+
+        CDirect2DRaysTables::Key tableKey{geometryKey(m_Side, m_Geometries2D), keys};
+        m_PrecalculatedResults = m_Tables != nullptr ? m_Tables->find(tableKey) : nullptr;
+        if(m_PrecalculatedResults != nullptr)
+        {
+            return;
+        }
+
+        std::vector<CDirect2DRaysResult> results(angles.size());
+        FenestrationCommon::parallel_for(
+          0u, angles.size(), [&](const size_t start, const size_t end) {
+              for(size_t i = start; i < end; ++i)
+              {
+                  results[i] = calculateAllProperties(angles[i]);
+              }
+          });
+
+        m_PrecalculatedResults =
+          std::make_shared<const CDirect2DRaysTable>(std::move(keys), std::move(results));
+        if(m_Tables != nullptr)
+        {
+            m_PrecalculatedResults = m_Tables->store(tableKey, m_PrecalculatedResults);
+        }
+    }
+
+    std::shared_ptr<const CDirect2DRaysTable> CDirect2DRays::precalculatedResults() const
+    {
+        return m_PrecalculatedResults;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////
     // CGeometry2DBeam
     ////////////////////////////////////////////////////////////////////////////////////////
 
-    CGeometry2DBeam::CGeometry2DBeam() :
-        m_Ray{{Side::Front, CDirect2DRays(Side::Front)}, {Side::Back, CDirect2DRays(Side::Back)}}
+    CGeometry2DBeam::CGeometry2DBeam(std::shared_ptr<CDirect2DRaysTables> t_Tables) :
+        m_Ray{{Side::Front, CDirect2DRays(Side::Front, t_Tables)},
+              {Side::Back, CDirect2DRays(Side::Back, t_Tables)}}
     {}
 
     void CGeometry2DBeam::appendGeometry2D(const CGeometry2D & t_Geometry2D)
@@ -417,6 +577,12 @@ namespace Viewer
         m_Ray.at(side).precalculateForProfileAngles(t_ProfileAngles);
     }
 
+    std::shared_ptr<const CDirect2DRaysTable>
+      CGeometry2DBeam::precalculatedResults(FenestrationCommon::Side const t_Side) const
+    {
+        return m_Ray.at(t_Side).precalculatedResults();
+    }
+
     long long int keyFromProfileAngle(double angle)
     {
         constexpr auto precision{1e9};
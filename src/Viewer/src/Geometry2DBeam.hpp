@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <optional>
 
 #include "ViewSegment2D.hpp"
@@ -124,6 +125,56 @@ namespace Viewer
         double m_ProfileAngle;
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysTable
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    // Precalculated results for set of profile angles. Results are stored in the order of sorted
+    // profile angles. Table does not change once it is created so it can be shared between
+    // geometries that are the same.
+    class CDirect2DRaysTable
+    {
+    public:
+        CDirect2DRaysTable(std::vector<long long> t_Keys,
+                           std::vector<CDirect2DRaysResult> t_Results);
+
+        // Index of the profile angle in the table
+        [[nodiscard]] std::optional<size_t> index(double t_ProfileAngle) const;
+        [[nodiscard]] const CDirect2DRaysResult & result(size_t t_Index) const;
+        [[nodiscard]] size_t size() const;
+
+    private:
+        std::vector<long long> m_Keys;
+        std::vector<CDirect2DRaysResult> m_Results;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CDirect2DRaysTables
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    // Store of precalculated tables owned by whoever creates the geometries. Geometries that are
+    // given the same store share tables when they have the same side, segments and profile
+    // angles. Tables are kept only as long as some geometry is using them.
+    class CDirect2DRaysTables
+    {
+    public:
+        using Key = std::pair<std::vector<double>, std::vector<long long>>;
+
+        [[nodiscard]] std::shared_ptr<const CDirect2DRaysTable> find(const Key & t_Key) const;
+
+        // Returns table that is already stored under the same key in case some other geometry
+        // inserted it in the meantime
+        std::shared_ptr<const CDirect2DRaysTable>
+          store(const Key & t_Key, std::shared_ptr<const CDirect2DRaysTable> t_Table);
+
+        // Number of tables that are still used by some geometry
+        [[nodiscard]] size_t size() const;
+
+    private:
+        mutable std::mutex m_Mutex;
+        std::map<Key, std::weak_ptr<const CDirect2DRaysTable>> m_Tables;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // CDirect2DRays
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -132,7 +183,8 @@ namespace Viewer
     class CDirect2DRays
     {
     public:
-        explicit CDirect2DRays(FenestrationCommon::Side t_Side);
+        explicit CDirect2DRays(FenestrationCommon::Side t_Side,
+                               std::shared_ptr<CDirect2DRaysTables> t_Tables = nullptr);
 
         void appendGeometry2D(const CGeometry2D & t_Geometry2D);
 
@@ -142,8 +194,13 @@ namespace Viewer
         // Direct to direct transmitted beam component
         double directToDirect(double t_ProfileAngle);
 
+        // Profile angles are calculated concurrently. Geometries that are the same, that are
+        // precalculated for the same profile angles and that have the same store will share
+        // results.
         void precalculateForProfileAngles(const std::vector<double> & t_ProfileAngles);
 
+        [[nodiscard]] std::shared_ptr<const CDirect2DRaysTable> precalculatedResults() const;
+
     private:
         struct RayBoundaries
         {
@@ -156,18 +213,18 @@ namespace Viewer
             [[nodiscard]] bool isInRay(CPoint2D const & t_Point) const;
         };
 
-        CDirect2DRaysResult calculateAllProperties(double t_ProfileAngle);
+        [[nodiscard]] CDirect2DRaysResult calculateAllProperties(double t_ProfileAngle) const;
 
         // Finds lower and upper ray of every enclosure in the system
-        RayBoundaries findRayBoundaries(double t_ProfileAngle);
+        [[nodiscard]] RayBoundaries findRayBoundaries(double t_ProfileAngle) const;
 
         // Finds all points that are on the path of the ray
-        std::vector<CDirect2DRay> findInBetweenRays(double t_ProfileAngle,
-                                                    RayBoundaries & boudnaries);
+        [[nodiscard]] std::vector<CDirect2DRay>
+          findInBetweenRays(double t_ProfileAngle, RayBoundaries & boudnaries) const;
 
         // Calculate beam view factors
-        CDirect2DRaysResult calculateBeamProperties(double t_ProfileAngle,
-                                                    std::vector<CDirect2DRay> & rays);
+        [[nodiscard]] CDirect2DRaysResult
+          calculateBeamProperties(double t_ProfileAngle, std::vector<CDirect2DRay> & rays) const;
 
 
         [[nodiscard]] CViewSegment2D createSubBeam(CPoint2D const & t_Point,
@@ -175,10 +232,15 @@ namespace Viewer
 
         FenestrationCommon::Side m_Side;
 
+        std::shared_ptr<CDirect2DRaysTables> m_Tables;
+
         std::vector<CGeometry2D> m_Geometries2D;
 
+        // Results for profile angles that were not precalculated
         std::map<long long, CDirect2DRaysResult> m_RayResults;
-        void checkForProfileAngle(double t_ProfileAngle);
+        std::shared_ptr<const CDirect2DRaysTable> m_PrecalculatedResults;
+
+        [[nodiscard]] const CDirect2DRaysResult & result(double t_ProfileAngle);
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -189,7 +251,8 @@ namespace Viewer
     class CGeometry2DBeam
     {
     public:
-        CGeometry2DBeam();
+        // Precalculated tables are shared only with geometries that have the same store
+        explicit CGeometry2DBeam(std::shared_ptr<CDirect2DRaysTables> t_Tables = nullptr);
 
         void appendGeometry2D(const CGeometry2D & t_Geometry2D);
 
@@ -202,6 +265,9 @@ namespace Viewer
         void precalculateForProfileAngles(FenestrationCommon::Side side,
                                           const std::vector<double> & t_ProfileAngles);
 
+        [[nodiscard]] std::shared_ptr<const CDirect2DRaysTable>
+          precalculatedResults(FenestrationCommon::Side t_Side) const;
+
     private:
         std::map<FenestrationCommon::Side, CDirect2DRays> m_Ray;
     };
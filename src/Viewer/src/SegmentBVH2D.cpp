@@ -0,0 +1,114 @@
+#include <algorithm>
+
+#include "SegmentBVH2D.hpp"
+#include "Segment2D.hpp"
+
+namespace Viewer
+{
+    namespace
+    {
+        // Maximum number of segments in the leaf node
+        const size_t leafSize{4u};
+    }   // namespace
+
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // BoundingBox2D
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    BoundingBox2D::BoundingBox2D(const CPoint2D & t_Point1, const CPoint2D & t_Point2) :
+        minX(std::min(t_Point1.x(), t_Point2.x())),
+        minY(std::min(t_Point1.y(), t_Point2.y())),
+        maxX(std::max(t_Point1.x(), t_Point2.x())),
+        maxY(std::max(t_Point1.y(), t_Point2.y()))
+    {}
+
+    BoundingBox2D::BoundingBox2D(const CSegment2D & t_Segment) :
+        BoundingBox2D(t_Segment.startPoint(), t_Segment.endPoint())
+    {}
+
+    BoundingBox2D BoundingBox2D::expand(const double t_Distance) const
+    {
+        BoundingBox2D result{*this};
+        result.minX -= t_Distance;
+        result.minY -= t_Distance;
+        result.maxX += t_Distance;
+        result.maxY += t_Distance;
+        return result;
+    }
+
+    BoundingBox2D BoundingBox2D::merge(const BoundingBox2D & t_Box) const
+    {
+        BoundingBox2D result;
+        result.minX = std::min(minX, t_Box.minX);
+        result.minY = std::min(minY, t_Box.minY);
+        result.maxX = std::max(maxX, t_Box.maxX);
+        result.maxY = std::max(maxY, t_Box.maxY);
+        return result;
+    }
+
+    bool BoundingBox2D::overlaps(const BoundingBox2D & t_Box) const
+    {
+        return minX <= t_Box.maxX && t_Box.minX <= maxX && minY <= t_Box.maxY
+               && t_Box.minY <= maxY;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////
+    // CSegmentBVH2D
+    ////////////////////////////////////////////////////////////////////////////////////////
+
+    CSegmentBVH2D::CSegmentBVH2D(const std::vector<BoundingBox2D> & t_Boxes) :
+        m_Boxes(t_Boxes),
+        m_Order(t_Boxes.size())
+    {
+        for(size_t i = 0u; i < m_Order.size(); ++i)
+        {
+            m_Order[i] = i;
+        }
+
+        if(!m_Boxes.empty())
+        {
+            m_Nodes.reserve(2u * m_Boxes.size());
+            build(0u, m_Boxes.size());
+        }
+    }
+
+    size_t CSegmentBVH2D::build(const size_t t_First, const size_t t_Last)
+    {
+        const auto index{m_Nodes.size()};
+        m_Nodes.emplace_back();
+
+        auto box{m_Boxes[m_Order[t_First]]};
+        for(size_t i = t_First + 1u; i < t_Last; ++i)
+        {
+            box = box.merge(m_Boxes[m_Order[i]]);
+        }
+        m_Nodes[index].box = box;
+
+        if(t_Last - t_First <= leafSize)
+        {
+            m_Nodes[index].first = t_First;
+            m_Nodes[index].count = t_Last - t_First;
+            return index;
+        }
+
+        // Splits segments by the median of box centers along longer side
+        const auto splitX{box.maxX - box.minX >= box.maxY - box.minY};
+        const auto center = [this, splitX](const size_t t_Index) {
+            const auto & aBox{m_Boxes[t_Index]};
+            return splitX ? aBox.minX + aBox.maxX : aBox.minY + aBox.maxY;
+        };
+        const auto middle{t_First + (t_Last - t_First) / 2u};
+        std::nth_element(m_Order.begin() + static_cast<std::ptrdiff_t>(t_First),
+                         m_Order.begin() + static_cast<std::ptrdiff_t>(middle),
+                         m_Order.begin() + static_cast<std::ptrdiff_t>(t_Last),
+                         [&center](const size_t a, const size_t b) { return center(a) < center(b); });
+
+        const auto left{build(t_First, middle)};
+        const auto right{build(middle, t_Last)};
+        m_Nodes[index].left = left;
+        m_Nodes[index].right = right;
+
+        return index;
+    }
+
+}   // namespace Viewer
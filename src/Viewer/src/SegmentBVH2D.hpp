@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+
+namespace Viewer
+{
+    class CPoint2D;
+    class CSegment2D;
+
+    // Axis aligned rectangle that bounds segments
+    struct BoundingBox2D
+    {
+        BoundingBox2D() = default;
+        BoundingBox2D(const CPoint2D & t_Point1, const CPoint2D & t_Point2);
+        explicit BoundingBox2D(const CSegment2D & t_Segment);
+
+        // Box enlarged for the given distance in every direction
+        [[nodiscard]] BoundingBox2D expand(double t_Distance) const;
+        [[nodiscard]] BoundingBox2D merge(const BoundingBox2D & t_Box) const;
+        [[nodiscard]] bool overlaps(const BoundingBox2D & t_Box) const;
+
+        double minX{0};
+        double minY{0};
+        double maxX{0};
+        double maxY{0};
+    };
+
+    // Bounding volume hierarchy over segments of the geometry. It is used to find segments that
+    // could be intersected by ray or that could be inside of some area without testing every
+    // segment of the geometry.
+    class CSegmentBVH2D
+    {
+    public:
+        CSegmentBVH2D() = default;
+        explicit CSegmentBVH2D(const std::vector<BoundingBox2D> & t_Boxes);
+
+        // Calls predicate with the index of every segment whose box overlaps given box until
+        // predicate returns true. Returns true if predicate returned true for any segment.
+        template<typename Predicate>
+        bool anyOf(const BoundingBox2D & t_Box, Predicate t_Predicate) const;
+
+    private:
+        struct Node
+        {
+            BoundingBox2D box;
+            // Leaf nodes hold segments [first, first + count) from m_Order. Inner nodes have zero
+            // count and indexes of their children.
+            size_t first{0u};
+            size_t count{0u};
+            size_t left{0u};
+            size_t right{0u};
+        };
+
+        size_t build(size_t t_First, size_t t_Last);
+
+        std::vector<BoundingBox2D> m_Boxes;
+        std::vector<size_t> m_Order;
+        std::vector<Node> m_Nodes;
+    };
+
+    template<typename Predicate>
+    bool CSegmentBVH2D::anyOf(const BoundingBox2D & t_Box, Predicate t_Predicate) const
+    {
+        if(m_Nodes.empty())
+        {
+            return false;
+        }
+
+        // Depth of the tree is logarithmic in number of segments since it is split by median
+        std::array<size_t, 64> stack{};
+        size_t stackSize{0u};
+        stack[stackSize++] = 0u;
+        while(stackSize > 0u)
+        {
+            const auto & node{m_Nodes[stack[--stackSize]]};
+            if(!node.box.overlaps(t_Box))
+            {
+                continue;
+            }
+            if(node.count > 0u)
+            {
+                for(size_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    if(m_Boxes[m_Order[i]].overlaps(t_Box) && t_Predicate(m_Order[i]))
+                    {
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                stack[stackSize++] = node.left;
+                stack[stackSize++] = node.right;
+            }
+        }
+
+        return false;
+    }
+
+}   // namespace Viewer
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <cmath>
+
+#include "WCECommon.hpp"
+#include "WCEViewer.hpp"
+
+using namespace Viewer;
+using namespace FenestrationCommon;
+
+// Beam geometry made of curved slats that is precalculated for set of profile angles must give the
+// same results as geometry that is calculating every profile angle on request.
+class TestEnclosure2DBeamPrecalculated : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        ThreadPool::instance().setNumberOfThreads(0u);
+    }
+
+    static std::shared_ptr<CGeometry2DBeam>
+      beamGeometry(const std::shared_ptr<CDirect2DRaysTables> & t_Tables = nullptr)
+    {
+        constexpr size_t numberOfSlats{3u};
+        constexpr size_t numberOfSegments{5u};
+        constexpr double slatSpacing{0.012};
+        constexpr double slatWidth{0.016};
+        constexpr double curvature{0.03};
+
+        auto aBeam = std::make_shared<CGeometry2DBeam>(t_Tables);
+        const auto halfAngle{std::asin(slatWidth / (2 * curvature))};
+        for(size_t slat = 0u; slat < numberOfSlats; ++slat)
+        {
+            const auto yCenter{static_cast<double>(slat) * slatSpacing - curvature};
+            CGeometry2D aEnclosure;
+            for(size_t i = 0u; i < numberOfSegments; ++i)
+            {
+                const auto angle1{-halfAngle + 2 * halfAngle * i / numberOfSegments};
+                const auto angle2{-halfAngle + 2 * halfAngle * (i + 1) / numberOfSegments};
+                const CPoint2D startPoint{slatWidth / 2 + curvature * std::sin(angle1),
+                                          yCenter + curvature * std::cos(angle1)};
+                const CPoint2D endPoint{slatWidth / 2 + curvature * std::sin(angle2),
+                                        yCenter + curvature * std::cos(angle2)};
+                aEnclosure.appendSegment(CViewSegment2D(startPoint, endPoint));
+            }
+            aBeam->appendGeometry2D(aEnclosure);
+        }
+
+        return aBeam;
+    }
+
+    static std::vector<double> profileAngles()
+    {
+        std::vector<double> result;
+        for(auto angle = -85.0; angle <= 85.0; angle += 5.0)
+        {
+            result.push_back(angle);
+        }
+        return result;
+    }
+
+    static void compareResults(CGeometry2DBeam & t_Beam1, CGeometry2DBeam & t_Beam2)
+    {
+        for(const auto side : {Side::Front, Side::Back})
+        {
+            for(const auto angle : profileAngles())
+            {
+                EXPECT_EQ(t_Beam1.directToDirect(angle, side),
+                          t_Beam2.directToDirect(angle, side));
+                const auto viewFactors1{t_Beam1.beamViewFactors(angle, side)};
+                const auto viewFactors2{t_Beam2.beamViewFactors(angle, side)};
+                ASSERT_EQ(viewFactors1.size(), viewFactors2.size());
+                for(size_t i = 0u; i < viewFactors1.size(); ++i)
+                {
+                    EXPECT_EQ(viewFactors1[i].enclosureIndex, viewFactors2[i].enclosureIndex);
+                    EXPECT_EQ(viewFactors1[i].segmentIndex, viewFactors2[i].segmentIndex);
+                    EXPECT_EQ(viewFactors1[i].value, viewFactors2[i].value);
+                    EXPECT_EQ(viewFactors1[i].percentHit, viewFactors2[i].percentHit);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(TestEnclosure2DBeamPrecalculated, SameAsCalculatedOnRequest)
+{
+    SCOPED_TRACE("Begin Test: Precalculated profile angles against calculation on request.");
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+
+    auto aPrecalculated{beamGeometry()};
+    aPrecalculated->precalculateForProfileAngles(Side::Front, profileAngles());
+    aPrecalculated->precalculateForProfileAngles(Side::Back, profileAngles());
+    ASSERT_NE(aPrecalculated->precalculatedResults(Side::Front), nullptr);
+    EXPECT_EQ(profileAngles().size(), aPrecalculated->precalculatedResults(Side::Front)->size());
+
+    auto aOnRequest{beamGeometry()};
+    EXPECT_EQ(aOnRequest->precalculatedResults(Side::Front), nullptr);
+
+    compareResults(*aPrecalculated, *aOnRequest);
+}
+
+TEST_F(TestEnclosure2DBeamPrecalculated, SingleAndMultipleThreads)
+{
+    SCOPED_TRACE("Begin Test: Precalculation with single and multiple threads.");
+
+    ThreadPool::instance().setNumberOfThreads(1u);
+    auto aSingle{beamGeometry()};
+    aSingle->precalculateForProfileAngles(Side::Front, profileAngles());
+    aSingle->precalculateForProfileAngles(Side::Back, profileAngles());
+
+    // Copies are not sharing precalculated results with the geometry above
+    std::vector<double> precalculatedAngles{profileAngles()};
+    precalculatedAngles.push_back(90.0);
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+    auto aMultiple{beamGeometry()};
+    aMultiple->precalculateForProfileAngles(Side::Front, precalculatedAngles);
+    aMultiple->precalculateForProfileAngles(Side::Back, precalculatedAngles);
+    EXPECT_NE(aSingle->precalculatedResults(Side::Front),
+              aMultiple->precalculatedResults(Side::Front));
+
+    compareResults(*aSingle, *aMultiple);
+}
+
+TEST_F(TestEnclosure2DBeamPrecalculated, SharedBetweenSameGeometries)
+{
+    SCOPED_TRACE("Begin Test: Same geometries with the same store are sharing results.");
+
+    const auto aTables{std::make_shared<CDirect2DRaysTables>()};
+
+    auto aBeam1{beamGeometry(aTables)};
+    aBeam1->precalculateForProfileAngles(Side::Front, profileAngles());
+
+    auto aBeam2{beamGeometry(aTables)};
+    aBeam2->precalculateForProfileAngles(Side::Front, profileAngles());
+
+    EXPECT_EQ(aBeam1->precalculatedResults(Side::Front), aBeam2->precalculatedResults(Side::Front));
+    EXPECT_EQ(1u, aTables->size());
+
+    // Geometry without the store keeps its own results
+    auto aBeam3{beamGeometry()};
+    aBeam3->precalculateForProfileAngles(Side::Front, profileAngles());
+    EXPECT_NE(aBeam1->precalculatedResults(Side::Front), aBeam3->precalculatedResults(Side::Front));
+    EXPECT_EQ(1u, aTables->size());
+
+    aBeam2->precalculateForProfileAngles(Side::Back, profileAngles());
+    EXPECT_NE(aBeam1->precalculatedResults(Side::Front), aBeam2->precalculatedResults(Side::Back));
+
+    // Geometry is changed and table is not valid anymore
+    CGeometry2D aEnclosure;
+    aEnclosure.appendSegment(CViewSegment2D({0, 0.05}, {0.016, 0.05}));
+    aBeam2->appendGeometry2D(aEnclosure);
+    EXPECT_EQ(aBeam2->precalculatedResults(Side::Front), nullptr);
+
+    aBeam2->precalculateForProfileAngles(Side::Front, profileAngles());
+    EXPECT_NE(aBeam1->precalculatedResults(Side::Front), aBeam2->precalculatedResults(Side::Front));
+
+    // Tables are not kept once geometries are not using them anymore
+    aBeam1.reset();
+    EXPECT_EQ(1u, aTables->size());
+    aBeam2.reset();
+    EXPECT_EQ(0u, aTables->size());
+}
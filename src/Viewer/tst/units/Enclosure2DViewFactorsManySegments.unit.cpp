@@ -0,0 +1,100 @@
+#include <memory>
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "WCEViewer.hpp"
+#include "WCECommon.hpp"
+
+using namespace Viewer;
+using namespace FenestrationCommon;
+
+// Enclosure made of many segments (polygon that approximates circle) with the blocking plate in
+// the middle of it.
+class TestEnclosure2DViewFactorsManySegments : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        ThreadPool::instance().setNumberOfThreads(0u);
+    }
+
+    static CGeometry2D circle(const size_t numberOfSegments, const bool withPlate)
+    {
+        CGeometry2D aEnclosure;
+
+        // Segments are oriented clockwise so they are facing inside of the circle
+        const auto radius{1.0};
+        const auto point = [&](const size_t index) {
+            const auto angle{-2 * ConstantsData::WCE_PI * static_cast<double>(index)
+                             / static_cast<double>(numberOfSegments)};
+            return CPoint2D{radius * std::cos(angle), radius * std::sin(angle)};
+        };
+        for(size_t i = 0u; i < numberOfSegments; ++i)
+        {
+            aEnclosure.appendSegment(CViewSegment2D{point(i), point(i + 1u)});
+        }
+
+        if(withPlate)
+        {
+            // Plate is made of two segments facing opposite directions
+            aEnclosure.appendSegment(CViewSegment2D{{-0.3, 0.05}, {0.3, 0.05}});
+            aEnclosure.appendSegment(CViewSegment2D{{0.3, 0.05}, {-0.3, 0.05}});
+        }
+
+        return aEnclosure;
+    }
+};
+
+TEST_F(TestEnclosure2DViewFactorsManySegments, ConvexEnclosure)
+{
+    SCOPED_TRACE("Begin Test: 2D Enclosure - View Factors (convex enclosure, many segments).");
+
+    auto aEnclosure{circle(64u, false)};
+    const auto viewFactors{aEnclosure.viewFactors()};
+
+    for(size_t i = 0u; i < viewFactors.size(); ++i)
+    {
+        auto sum{0.0};
+        for(size_t j = 0u; j < viewFactors.size(); ++j)
+        {
+            sum += viewFactors(i, j);
+        }
+        EXPECT_NEAR(1.0, sum, 1e-10);
+    }
+}
+
+TEST_F(TestEnclosure2DViewFactorsManySegments, BlockingSurfaceThreads)
+{
+    SCOPED_TRACE("Begin Test: 2D Enclosure - View Factors (blocking surface, many segments).");
+
+    ThreadPool::instance().setNumberOfThreads(1u);
+    auto serialEnclosure{circle(48u, true)};
+    const auto serial{serialEnclosure.viewFactors()};
+
+    ThreadPool::instance().setNumberOfThreads(4u);
+    auto parallelEnclosure{circle(48u, true)};
+    const auto parallel{parallelEnclosure.viewFactors()};
+
+    ASSERT_EQ(serial.size(), parallel.size());
+    const auto & segments{serialEnclosure.segments()};
+    for(size_t i = 0u; i < serial.size(); ++i)
+    {
+        for(size_t j = 0u; j < serial.size(); ++j)
+        {
+            EXPECT_EQ(serial(i, j), parallel(i, j));
+            // Reciprocity
+            EXPECT_NEAR(serial(i, j) * segments[i].length(),
+                        serial(j, i) * segments[j].length(),
+                        1e-12);
+        }
+    }
+
+    // Segments on the opposite sides of the plate cannot see each other
+    EXPECT_EQ(0.0, serial(12, 36));
+    EXPECT_EQ(0.0, serial(36, 12));
+    // Plate segments are seeing only one half of the circle
+    EXPECT_GT(serial(48, 12), 0.0);
+    EXPECT_EQ(0.0, serial(48, 36));
+    EXPECT_GT(serial(49, 36), 0.0);
+    EXPECT_EQ(0.0, serial(49, 12));
+}